@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/revlanguage/main.cpp" "CMakeFiles/rb.dir/root/repo/src/revlanguage/main.cpp.o" "gcc" "CMakeFiles/rb.dir/root/repo/src/revlanguage/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/projects/cmake/build/revlanguage/CMakeFiles/rb-parser.dir/DependInfo.cmake"
+  "/root/repo/projects/cmake/build/core/CMakeFiles/rb-core.dir/DependInfo.cmake"
+  "/root/repo/projects/cmake/build/libs/CMakeFiles/libs.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../rb"
+  "../rb.pdb"
+  "CMakeFiles/rb.dir/root/repo/src/revlanguage/main.cpp.o"
+  "CMakeFiles/rb.dir/root/repo/src/revlanguage/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rb.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
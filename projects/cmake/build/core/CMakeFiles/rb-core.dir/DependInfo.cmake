@@ -0,0 +1,659 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/core/analysis/BootstrapAnalysis.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/BootstrapAnalysis.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/BootstrapAnalysis.cpp.o.d"
+  "/root/repo/src/core/analysis/HillClimber.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/HillClimber.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/HillClimber.cpp.o.d"
+  "/root/repo/src/core/analysis/MaximumLikelihoodAnalysis.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/MaximumLikelihoodAnalysis.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/MaximumLikelihoodAnalysis.cpp.o.d"
+  "/root/repo/src/core/analysis/MaximumLikelihoodEstimation.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/MaximumLikelihoodEstimation.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/MaximumLikelihoodEstimation.cpp.o.d"
+  "/root/repo/src/core/analysis/Model.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/Model.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/Model.cpp.o.d"
+  "/root/repo/src/core/analysis/MonteCarloAnalysis.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/MonteCarloAnalysis.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/MonteCarloAnalysis.cpp.o.d"
+  "/root/repo/src/core/analysis/PosteriorPredictiveAnalysis.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/PosteriorPredictiveAnalysis.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/PosteriorPredictiveAnalysis.cpp.o.d"
+  "/root/repo/src/core/analysis/PosteriorPredictiveSimulation.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/PosteriorPredictiveSimulation.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/PosteriorPredictiveSimulation.cpp.o.d"
+  "/root/repo/src/core/analysis/PowerPosteriorAnalysis.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/PowerPosteriorAnalysis.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/PowerPosteriorAnalysis.cpp.o.d"
+  "/root/repo/src/core/analysis/ValidationAnalysis.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/ValidationAnalysis.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/ValidationAnalysis.cpp.o.d"
+  "/root/repo/src/core/analysis/mcmc/MarginalLikelihoodEstimator.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/MarginalLikelihoodEstimator.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/MarginalLikelihoodEstimator.cpp.o.d"
+  "/root/repo/src/core/analysis/mcmc/Mcmc.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/Mcmc.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/Mcmc.cpp.o.d"
+  "/root/repo/src/core/analysis/mcmc/Mcmcmc.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/Mcmcmc.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/Mcmcmc.cpp.o.d"
+  "/root/repo/src/core/analysis/mcmc/MonteCarloSampler.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/MonteCarloSampler.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/MonteCarloSampler.cpp.o.d"
+  "/root/repo/src/core/analysis/mcmc/PathSampler.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/PathSampler.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/PathSampler.cpp.o.d"
+  "/root/repo/src/core/analysis/mcmc/SteppingStoneSampler.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/SteppingStoneSampler.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/SteppingStoneSampler.cpp.o.d"
+  "/root/repo/src/core/analysis/mcmc/WangLandauMcmc.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/WangLandauMcmc.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/WangLandauMcmc.cpp.o.d"
+  "/root/repo/src/core/analysis/mcmc/convergence/EssMax.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/EssMax.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/EssMax.cpp.o.d"
+  "/root/repo/src/core/analysis/mcmc/convergence/EssTest.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/EssTest.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/EssTest.cpp.o.d"
+  "/root/repo/src/core/analysis/mcmc/convergence/GelmanRubinTest.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/GelmanRubinTest.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/GelmanRubinTest.cpp.o.d"
+  "/root/repo/src/core/analysis/mcmc/convergence/GewekeTest.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/GewekeTest.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/GewekeTest.cpp.o.d"
+  "/root/repo/src/core/analysis/mcmc/convergence/HeidelbergerWelchTest.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/HeidelbergerWelchTest.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/HeidelbergerWelchTest.cpp.o.d"
+  "/root/repo/src/core/analysis/mcmc/convergence/SemMin.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/SemMin.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/SemMin.cpp.o.d"
+  "/root/repo/src/core/analysis/mcmc/convergence/StationarityTest.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/StationarityTest.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/StationarityTest.cpp.o.d"
+  "/root/repo/src/core/analysis/mcmc/convergence/TraceAccumulator.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/TraceAccumulator.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/TraceAccumulator.cpp.o.d"
+  "/root/repo/src/core/analysis/mcmc/convergence/TraceAccumulatorRegistry.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/TraceAccumulatorRegistry.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/TraceAccumulatorRegistry.cpp.o.d"
+  "/root/repo/src/core/analysis/mcmc/output/JointAncestralStateTrace.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/output/JointAncestralStateTrace.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/output/JointAncestralStateTrace.cpp.o.d"
+  "/root/repo/src/core/analysis/mcmc/output/Trace.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/output/Trace.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/output/Trace.cpp.o.d"
+  "/root/repo/src/core/analysis/mcmc/output/TraceNumeric.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/output/TraceNumeric.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/output/TraceNumeric.cpp.o.d"
+  "/root/repo/src/core/analysis/mcmc/output/TraceTree.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/output/TraceTree.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/output/TraceTree.cpp.o.d"
+  "/root/repo/src/core/analysis/stoppingRule/AbstractConvergenceStoppingRule.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/AbstractConvergenceStoppingRule.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/AbstractConvergenceStoppingRule.cpp.o.d"
+  "/root/repo/src/core/analysis/stoppingRule/GelmanRubinStoppingRule.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/GelmanRubinStoppingRule.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/GelmanRubinStoppingRule.cpp.o.d"
+  "/root/repo/src/core/analysis/stoppingRule/GewekeStoppingRule.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/GewekeStoppingRule.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/GewekeStoppingRule.cpp.o.d"
+  "/root/repo/src/core/analysis/stoppingRule/MaxIterationStoppingRule.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/MaxIterationStoppingRule.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/MaxIterationStoppingRule.cpp.o.d"
+  "/root/repo/src/core/analysis/stoppingRule/MaxTimeStoppingRule.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/MaxTimeStoppingRule.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/MaxTimeStoppingRule.cpp.o.d"
+  "/root/repo/src/core/analysis/stoppingRule/MinEssStoppingRule.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/MinEssStoppingRule.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/MinEssStoppingRule.cpp.o.d"
+  "/root/repo/src/core/analysis/stoppingRule/StationarityStoppingRule.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/StationarityStoppingRule.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/StationarityStoppingRule.cpp.o.d"
+  "/root/repo/src/core/analysis/stoppingRule/StoppingRule.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/StoppingRule.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/StoppingRule.cpp.o.d"
+  "/root/repo/src/core/dag/ContinuousStochasticNode.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/dag/ContinuousStochasticNode.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/dag/ContinuousStochasticNode.cpp.o.d"
+  "/root/repo/src/core/dag/DagNode.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/dag/DagNode.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/dag/DagNode.cpp.o.d"
+  "/root/repo/src/core/datatypes/DagNodeMap.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/DagNodeMap.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/DagNodeMap.cpp.o.d"
+  "/root/repo/src/core/datatypes/MultiValueEvent.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/MultiValueEvent.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/MultiValueEvent.cpp.o.d"
+  "/root/repo/src/core/datatypes/Parallelizable.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/Parallelizable.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/Parallelizable.cpp.o.d"
+  "/root/repo/src/core/datatypes/RbBitSet.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/RbBitSet.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/RbBitSet.cpp.o.d"
+  "/root/repo/src/core/datatypes/RbBoolean.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/RbBoolean.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/RbBoolean.cpp.o.d"
+  "/root/repo/src/core/datatypes/Serializable.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/Serializable.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/Serializable.cpp.o.d"
+  "/root/repo/src/core/datatypes/math/CorrespondenceAnalysis.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/CorrespondenceAnalysis.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/CorrespondenceAnalysis.cpp.o.d"
+  "/root/repo/src/core/datatypes/math/DualityDiagram.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/DualityDiagram.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/DualityDiagram.cpp.o.d"
+  "/root/repo/src/core/datatypes/math/MatrixComplex.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/MatrixComplex.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/MatrixComplex.cpp.o.d"
+  "/root/repo/src/core/datatypes/math/MatrixReal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/MatrixReal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/MatrixReal.cpp.o.d"
+  "/root/repo/src/core/datatypes/math/Simplex.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/Simplex.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/Simplex.cpp.o.d"
+  "/root/repo/src/core/datatypes/math/TransitionProbabilityMatrix.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/TransitionProbabilityMatrix.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/TransitionProbabilityMatrix.cpp.o.d"
+  "/root/repo/src/core/datatypes/math/TransitionProbabilityMatrixPool.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/TransitionProbabilityMatrixPool.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/TransitionProbabilityMatrixPool.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/DistanceMatrix.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/DistanceMatrix.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/DistanceMatrix.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/RelativeNodeAgeConstraints.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/RelativeNodeAgeConstraints.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/RelativeNodeAgeConstraints.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/RelativeNodeAgeWeightedConstraints.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/RelativeNodeAgeWeightedConstraints.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/RelativeNodeAgeWeightedConstraints.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/Taxon.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/Taxon.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/Taxon.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/TaxonMap.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/TaxonMap.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/TaxonMap.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/TimeInterval.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/TimeInterval.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/TimeInterval.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/TreeDiscreteCharacterData.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/TreeDiscreteCharacterData.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/TreeDiscreteCharacterData.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/character/AminoAcidState.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/AminoAcidState.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/AminoAcidState.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/character/BinaryState.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/BinaryState.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/BinaryState.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/character/CharacterState.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/CharacterState.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/CharacterState.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/character/CharacterTranslator.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/CharacterTranslator.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/CharacterTranslator.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/character/CodonState.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/CodonState.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/CodonState.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/character/DiscreteCharacterState.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/DiscreteCharacterState.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/DiscreteCharacterState.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/character/DnaState.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/DnaState.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/DnaState.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/character/NaturalNumbersState.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/NaturalNumbersState.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/NaturalNumbersState.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/character/PoMoState.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/PoMoState.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/PoMoState.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/character/PoMoState4.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/PoMoState4.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/PoMoState4.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/character/RnaState.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/RnaState.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/RnaState.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/character/StandardState.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/StandardState.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/StandardState.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/character/TripletState.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/TripletState.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/TripletState.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractCharacterData.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractCharacterData.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractCharacterData.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractDiscreteTaxonData.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractDiscreteTaxonData.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractDiscreteTaxonData.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractHomologousDiscreteCharacterData.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractHomologousDiscreteCharacterData.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractHomologousDiscreteCharacterData.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractNonHomologousDiscreteCharacterData.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractNonHomologousDiscreteCharacterData.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractNonHomologousDiscreteCharacterData.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractTaxonData.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractTaxonData.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractTaxonData.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/characterdata/ContinuousCharacterData.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/ContinuousCharacterData.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/ContinuousCharacterData.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/characterdata/ContinuousTaxonData.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/ContinuousTaxonData.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/ContinuousTaxonData.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/characterdata/HomologousCharacterData.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/HomologousCharacterData.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/HomologousCharacterData.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/characterdata/NonHomologousCharacterData.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/NonHomologousCharacterData.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/NonHomologousCharacterData.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/characterhistory/BranchHistory.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/BranchHistory.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/BranchHistory.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/characterhistory/BranchHistoryContinuous.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/BranchHistoryContinuous.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/BranchHistoryContinuous.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/characterhistory/BranchHistoryDiscrete.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/BranchHistoryDiscrete.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/BranchHistoryDiscrete.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterEvent.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterEvent.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterEvent.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterEventContinuous.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterEventContinuous.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterEventContinuous.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterEventDiscrete.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterEventDiscrete.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterEventDiscrete.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterHistory.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterHistory.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterHistory.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterHistoryContinuous.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterHistoryContinuous.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterHistoryContinuous.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterHistoryDiscrete.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterHistoryDiscrete.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterHistoryDiscrete.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/cladogeneticmatrix/CladogeneticProbabilityMatrix.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/cladogeneticmatrix/CladogeneticProbabilityMatrix.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/cladogeneticmatrix/CladogeneticProbabilityMatrix.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/cladogeneticmatrix/CladogeneticProbabilityMatrix_Epoch.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/cladogeneticmatrix/CladogeneticProbabilityMatrix_Epoch.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/cladogeneticmatrix/CladogeneticProbabilityMatrix_Epoch.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/cladogeneticmatrix/CladogeneticSpeciationRateMatrix.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/cladogeneticmatrix/CladogeneticSpeciationRateMatrix.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/cladogeneticmatrix/CladogeneticSpeciationRateMatrix.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/geography/GeographicArea.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/geography/GeographicArea.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/geography/GeographicArea.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/geography/TimeAtlas.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/geography/TimeAtlas.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/geography/TimeAtlas.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratemap/AdjacentRateModifier.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/AdjacentRateModifier.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/AdjacentRateModifier.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratemap/CharacterHistoryRateModifier.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/CharacterHistoryRateModifier.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/CharacterHistoryRateModifier.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratemap/DistanceRateModifier.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/DistanceRateModifier.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/DistanceRateModifier.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratemap/HostSwitchRateModifier.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/HostSwitchRateModifier.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/HostSwitchRateModifier.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratemap/RangeEvolutionRateModifier.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/RangeEvolutionRateModifier.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/RangeEvolutionRateModifier.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratemap/RateGeneratorSequence.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/RateGeneratorSequence.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/RateGeneratorSequence.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratemap/RateGeneratorSequenceUsingMatrix.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/RateGeneratorSequenceUsingMatrix.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/RateGeneratorSequenceUsingMatrix.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratemap/RateGeneratorSequence_Biogeography.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/RateGeneratorSequence_Biogeography.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/RateGeneratorSequence_Biogeography.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratemap/SiteRateModifier.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/SiteRateModifier.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/SiteRateModifier.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratemap/StateCountRateModifier.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/StateCountRateModifier.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/StateCountRateModifier.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/AbstractRateMatrix.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/AbstractRateMatrix.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/AbstractRateMatrix.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/GeneralRateMatrix.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/GeneralRateMatrix.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/GeneralRateMatrix.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateGenerator.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateGenerator.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateGenerator.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateGenerator_Epoch.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateGenerator_Epoch.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateGenerator_Epoch.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Blosum62.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Blosum62.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Blosum62.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Chromosomes.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Chromosomes.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Chromosomes.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_ChromosomesPloidy.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_ChromosomesPloidy.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_ChromosomesPloidy.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_CodonSynonymousNonsynonymous.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_CodonSynonymousNonsynonymous.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_CodonSynonymousNonsynonymous.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_CodonSynonymousNonsynonymousHKY.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_CodonSynonymousNonsynonymousHKY.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_CodonSynonymousNonsynonymousHKY.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Covarion.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Covarion.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Covarion.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_CpRev.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_CpRev.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_CpRev.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_DECRateMatrix.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_DECRateMatrix.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_DECRateMatrix.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Dayhoff.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Dayhoff.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Dayhoff.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Empirical.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Empirical.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Empirical.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_F81.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_F81.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_F81.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_FreeBinary.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_FreeBinary.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_FreeBinary.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_FreeK.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_FreeK.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_FreeK.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_FreeSymmetric.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_FreeSymmetric.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_FreeSymmetric.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_GTR.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_GTR.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_GTR.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_HKY.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_HKY.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_HKY.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_InfiniteSites.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_InfiniteSites.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_InfiniteSites.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_JC.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_JC.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_JC.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Jones.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Jones.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Jones.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Kimura80.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Kimura80.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Kimura80.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Kimura81.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Kimura81.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Kimura81.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_LG.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_LG.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_LG.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_MtMam.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_MtMam.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_MtMam.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_MtRev24.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_MtRev24.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_MtRev24.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Ordered.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Ordered.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Ordered.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_PoMo.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_PoMo.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_PoMo.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_PoMo.temp_caseinsensitive_rename.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_PoMo.temp_caseinsensitive_rename.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_PoMo.temp_caseinsensitive_rename.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_PoMo4.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_PoMo4.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_PoMo4.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_ReversiblePoMo.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_ReversiblePoMo.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_ReversiblePoMo.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_RtRev.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_RtRev.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_RtRev.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Senca.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Senca.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Senca.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_TIM.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_TIM.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_TIM.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_TVM.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_TVM.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_TVM.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Tamura92.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Tamura92.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Tamura92.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_TamuraNei.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_TamuraNei.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_TamuraNei.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Vt.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Vt.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Vt.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Wag.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Wag.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Wag.cpp.o.d"
+  "/root/repo/src/core/datatypes/phylogenetics/ratematrix/TimeReversibleRateMatrix.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/TimeReversibleRateMatrix.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/TimeReversibleRateMatrix.cpp.o.d"
+  "/root/repo/src/core/datatypes/trees/Clade.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/trees/Clade.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/trees/Clade.cpp.o.d"
+  "/root/repo/src/core/datatypes/trees/RootedTripletDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/trees/RootedTripletDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/trees/RootedTripletDistribution.cpp.o.d"
+  "/root/repo/src/core/datatypes/trees/TopologyNode.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/trees/TopologyNode.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/trees/TopologyNode.cpp.o.d"
+  "/root/repo/src/core/datatypes/trees/Tree.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/trees/Tree.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/trees/Tree.cpp.o.d"
+  "/root/repo/src/core/datatypes/trees/TreeChangeEventHandler.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/trees/TreeChangeEventHandler.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/trees/TreeChangeEventHandler.cpp.o.d"
+  "/root/repo/src/core/distributions/Distribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/Distribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/Distribution.cpp.o.d"
+  "/root/repo/src/core/distributions/MultiValueEventDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/MultiValueEventDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/MultiValueEventDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/BernoulliDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/BernoulliDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/BernoulliDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/BetaDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/BetaDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/BetaDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/BimodalLognormalDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/BimodalLognormalDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/BimodalLognormalDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/BimodalNormalDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/BimodalNormalDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/BimodalNormalDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/BinomialDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/BinomialDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/BinomialDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/BivariatePoissonDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/BivariatePoissonDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/BivariatePoissonDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/CategoricalDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/CategoricalDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/CategoricalDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/CauchyDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/CauchyDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/CauchyDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/ChisqDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/ChisqDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/ChisqDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/CompoundPoissonNormalDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/CompoundPoissonNormalDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/CompoundPoissonNormalDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/ContinuousDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/ContinuousDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/ContinuousDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/DecomposedInverseWishartDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/DecomposedInverseWishartDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/DecomposedInverseWishartDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/DirichletDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/DirichletDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/DirichletDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/ExponentialDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/ExponentialDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/ExponentialDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/ExponentialWithOffsetDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/ExponentialWithOffsetDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/ExponentialWithOffsetDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/GammaDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/GammaDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/GammaDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/GeometricDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/GeometricDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/GeometricDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/GilbertGraphDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/GilbertGraphDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/GilbertGraphDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/HalfCauchyDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/HalfCauchyDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/HalfCauchyDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/HalfNormalDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/HalfNormalDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/HalfNormalDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/InverseGammaDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/InverseGammaDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/InverseGammaDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/InverseWishartDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/InverseWishartDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/InverseWishartDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/LKJDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LKJDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LKJDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/LKJPartialDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LKJPartialDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LKJPartialDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/LaplaceDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LaplaceDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LaplaceDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/LogExponentialDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LogExponentialDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LogExponentialDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/LogUniformDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LogUniformDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LogUniformDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/LognormalDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LognormalDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LognormalDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/LognormalWithOffsetDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LognormalWithOffsetDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LognormalWithOffsetDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/MultinomialDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/MultinomialDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/MultinomialDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/MultivariateNormalDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/MultivariateNormalDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/MultivariateNormalDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/NegativeBinomialDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/NegativeBinomialDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/NegativeBinomialDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/NormalDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/NormalDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/NormalDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/OrnsteinUhlenbeckProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/OrnsteinUhlenbeckProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/OrnsteinUhlenbeckProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/math/PointMassDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/PointMassDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/PointMassDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/PoissonDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/PoissonDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/PoissonDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/ScaledDirichletDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/ScaledDirichletDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/ScaledDirichletDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/SoftBoundUniformNormalDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/SoftBoundUniformNormalDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/SoftBoundUniformNormalDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/StudentTDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/StudentTDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/StudentTDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/UniformDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/UniformDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/UniformDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/UniformIntegerDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/UniformIntegerDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/UniformIntegerDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/VarianceGammaDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/VarianceGammaDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/VarianceGammaDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/WhiteNoiseDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/WhiteNoiseDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/WhiteNoiseDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/math/WishartDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/WishartDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/WishartDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/MPEST.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/MPEST.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/MPEST.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/continuousCharacter/AbstractPhyloBrownianProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/AbstractPhyloBrownianProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/AbstractPhyloBrownianProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/continuousCharacter/AbstractPhyloContinuousCharacterHistoryProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/AbstractPhyloContinuousCharacterHistoryProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/AbstractPhyloContinuousCharacterHistoryProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/continuousCharacter/AbstractPhyloContinuousCharacterProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/AbstractPhyloContinuousCharacterProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/AbstractPhyloContinuousCharacterProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianCharacterHistoryProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianCharacterHistoryProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianCharacterHistoryProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianProcessMVN.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianProcessMVN.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianProcessMVN.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianProcessMultiSampleREML.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianProcessMultiSampleREML.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianProcessMultiSampleREML.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianProcessREML.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianProcessREML.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianProcessREML.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultiSampleOrnsteinUhlenbeckProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultiSampleOrnsteinUhlenbeckProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultiSampleOrnsteinUhlenbeckProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultiSampleOrnsteinUhlenbeckProcessREML.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultiSampleOrnsteinUhlenbeckProcessREML.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultiSampleOrnsteinUhlenbeckProcessREML.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultivariateBrownianProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultivariateBrownianProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultivariateBrownianProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultivariateBrownianProcessMultiSampleREML.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultivariateBrownianProcessMultiSampleREML.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultivariateBrownianProcessMultiSampleREML.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultivariateBrownianProcessREML.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultivariateBrownianProcessREML.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultivariateBrownianProcessREML.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckProcessEVE.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckProcessEVE.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckProcessEVE.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckProcessMVN.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckProcessMVN.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckProcessMVN.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckREML.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckREML.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckREML.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckThreePoint.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckThreePoint.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckThreePoint.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloWhiteNoiseProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloWhiteNoiseProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloWhiteNoiseProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCCompressedAlignment.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCCompressedAlignment.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCCompressedAlignment.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCKernels.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCKernels.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCKernels.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCSiteHomogeneousBinary.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCSiteHomogeneousBinary.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCSiteHomogeneousBinary.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCSiteHomogeneousDollo.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCSiteHomogeneousDollo.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCSiteHomogeneousDollo.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCSiteHomogeneousDolloBinary.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCSiteHomogeneousDolloBinary.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCSiteHomogeneousDolloBinary.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/substitution/PhyloDistanceGamma.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/substitution/PhyloDistanceGamma.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/substitution/PhyloDistanceGamma.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/AbstractMultispeciesCoalescent.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/AbstractMultispeciesCoalescent.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/AbstractMultispeciesCoalescent.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/AbstractRootedTreeDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/AbstractRootedTreeDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/AbstractRootedTreeDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/DuplicationLossProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/DuplicationLossProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/DuplicationLossProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescent.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescent.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescent.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescentInverseGammaPrior.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescentInverseGammaPrior.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescentInverseGammaPrior.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescentMigration.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescentMigration.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescentMigration.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescentMigrationODE.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescentMigrationODE.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescentMigrationODE.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescentUniformPrior.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescentUniformPrior.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescentUniformPrior.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/NodeAgeConstrainedTreeDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/NodeAgeConstrainedTreeDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/NodeAgeConstrainedTreeDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/NodeOrderConstrainedTreeDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/NodeOrderConstrainedTreeDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/NodeOrderConstrainedTreeDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/NodeOrderWeightedConstrainedTreeDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/NodeOrderWeightedConstrainedTreeDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/NodeOrderWeightedConstrainedTreeDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/TopologyConstrainedTreeDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/TopologyConstrainedTreeDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/TopologyConstrainedTreeDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/UltrametricTreeDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/UltrametricTreeDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/UltrametricTreeDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/UniformTimeTreeDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/UniformTimeTreeDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/UniformTimeTreeDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/UniformTopologyBranchLengthDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/UniformTopologyBranchLengthDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/UniformTopologyBranchLengthDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/UniformTopologyDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/UniformTopologyDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/UniformTopologyDistribution.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/AbstractBirthDeathProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/AbstractBirthDeathProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/AbstractBirthDeathProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/AbstractCharacterHistoryBirthDeathProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/AbstractCharacterHistoryBirthDeathProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/AbstractCharacterHistoryBirthDeathProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/AbstractPiecewiseConstantFossilizedRangeProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/AbstractPiecewiseConstantFossilizedRangeProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/AbstractPiecewiseConstantFossilizedRangeProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/BirthDeathBurstProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/BirthDeathBurstProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/BirthDeathBurstProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/BirthDeathProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/BirthDeathProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/BirthDeathProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/CDCladoSE.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/CDCladoSE.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/CDCladoSE.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/CDCladoSEExtinction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/CDCladoSEExtinction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/CDCladoSEExtinction.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/CDCladoSEObserved.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/CDCladoSEObserved.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/CDCladoSEObserved.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConditionedBirthDeathShiftProcessContinuous.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConditionedBirthDeathShiftProcessContinuous.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConditionedBirthDeathShiftProcessContinuous.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConstantRateBirthDeathProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConstantRateBirthDeathProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConstantRateBirthDeathProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConstantRateCompleteBirthDeathProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConstantRateCompleteBirthDeathProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConstantRateCompleteBirthDeathProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConstantRateOutgroupBirthDeathProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConstantRateOutgroupBirthDeathProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConstantRateOutgroupBirthDeathProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConstantRateSerialSampledBirthDeathProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConstantRateSerialSampledBirthDeathProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConstantRateSerialSampledBirthDeathProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/DivergenceTimeCDF.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/DivergenceTimeCDF.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/DivergenceTimeCDF.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/DiversityDependentPureBirthProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/DiversityDependentPureBirthProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/DiversityDependentPureBirthProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/EpisodicBirthDeathProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/EpisodicBirthDeathProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/EpisodicBirthDeathProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/EpisodicBirthDeathSamplingTreatmentProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/EpisodicBirthDeathSamplingTreatmentProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/EpisodicBirthDeathSamplingTreatmentProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/HeterogeneousRateBirthDeath.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/HeterogeneousRateBirthDeath.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/HeterogeneousRateBirthDeath.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/MixedSamplingBirthDeathProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/MixedSamplingBirthDeathProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/MixedSamplingBirthDeathProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/OdeHeterogeneousRateBirthDeath.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/OdeHeterogeneousRateBirthDeath.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/OdeHeterogeneousRateBirthDeath.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/PiecewiseConstantFossilizedBirthDeathProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/PiecewiseConstantFossilizedBirthDeathProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/PiecewiseConstantFossilizedBirthDeathProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/PiecewiseConstantFossilizedBirthDeathRangeProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/PiecewiseConstantFossilizedBirthDeathRangeProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/PiecewiseConstantFossilizedBirthDeathRangeProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/PiecewiseConstantSerialSampledBirthDeathProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/PiecewiseConstantSerialSampledBirthDeathProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/PiecewiseConstantSerialSampledBirthDeathProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/SSE_ODE.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/SSE_ODE.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/SSE_ODE.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/SampledSpeciationBirthDeathProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/SampledSpeciationBirthDeathProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/SampledSpeciationBirthDeathProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/StateDependentSpeciationExtinctionProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/StateDependentSpeciationExtinctionProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/StateDependentSpeciationExtinctionProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/TimeVaryingStateDependentSpeciationExtinctionProcess.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/TimeVaryingStateDependentSpeciationExtinctionProcess.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/TimeVaryingStateDependentSpeciationExtinctionProcess.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/coalescent/AbstractCoalescent.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/AbstractCoalescent.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/AbstractCoalescent.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/coalescent/ConstantPopulationCoalescent.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/ConstantPopulationCoalescent.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/ConstantPopulationCoalescent.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/coalescent/ConstantPopulationHeterochronousCoalescent.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/ConstantPopulationHeterochronousCoalescent.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/ConstantPopulationHeterochronousCoalescent.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/coalescent/HeterochronousCoalescent.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/HeterochronousCoalescent.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/HeterochronousCoalescent.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/coalescent/PiecewiseConstantCoalescent.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/PiecewiseConstantCoalescent.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/PiecewiseConstantCoalescent.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/coalescent/PiecewiseConstantHeterochronousCoalescent.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/PiecewiseConstantHeterochronousCoalescent.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/PiecewiseConstantHeterochronousCoalescent.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/coalescent/demography/ConstantDemographicFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/demography/ConstantDemographicFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/demography/ConstantDemographicFunction.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/coalescent/demography/DemographicFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/demography/DemographicFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/demography/DemographicFunction.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/coalescent/demography/ExponentialDemographicFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/demography/ExponentialDemographicFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/demography/ExponentialDemographicFunction.cpp.o.d"
+  "/root/repo/src/core/distributions/phylogenetics/tree/coalescent/demography/LinearDemographicFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/demography/LinearDemographicFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/demography/LinearDemographicFunction.cpp.o.d"
+  "/root/repo/src/core/functions/Function.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/Function.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/Function.cpp.o.d"
+  "/root/repo/src/core/functions/builtin/LogicalAndFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/LogicalAndFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/LogicalAndFunction.cpp.o.d"
+  "/root/repo/src/core/functions/builtin/LogicalOrFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/LogicalOrFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/LogicalOrFunction.cpp.o.d"
+  "/root/repo/src/core/functions/builtin/LogicalUnotFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/LogicalUnotFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/LogicalUnotFunction.cpp.o.d"
+  "/root/repo/src/core/functions/builtin/MaxFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/MaxFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/MaxFunction.cpp.o.d"
+  "/root/repo/src/core/functions/builtin/MeanFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/MeanFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/MeanFunction.cpp.o.d"
+  "/root/repo/src/core/functions/builtin/MedianFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/MedianFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/MedianFunction.cpp.o.d"
+  "/root/repo/src/core/functions/builtin/MinFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/MinFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/MinFunction.cpp.o.d"
+  "/root/repo/src/core/functions/builtin/ModuloFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/ModuloFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/ModuloFunction.cpp.o.d"
+  "/root/repo/src/core/functions/builtin/NormalizeVectorFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/NormalizeVectorFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/NormalizeVectorFunction.cpp.o.d"
+  "/root/repo/src/core/functions/builtin/StandardDeviationFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/StandardDeviationFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/StandardDeviationFunction.cpp.o.d"
+  "/root/repo/src/core/functions/builtin/SumFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/SumFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/SumFunction.cpp.o.d"
+  "/root/repo/src/core/functions/builtin/SumIntegerFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/SumIntegerFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/SumIntegerFunction.cpp.o.d"
+  "/root/repo/src/core/functions/builtin/VarianceFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/VarianceFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/VarianceFunction.cpp.o.d"
+  "/root/repo/src/core/functions/distribution/CummulativeDistributionFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/CummulativeDistributionFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/CummulativeDistributionFunction.cpp.o.d"
+  "/root/repo/src/core/functions/distribution/DecomposedVarianceCovarianceFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DecomposedVarianceCovarianceFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DecomposedVarianceCovarianceFunction.cpp.o.d"
+  "/root/repo/src/core/functions/distribution/DiscretizeBetaFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DiscretizeBetaFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DiscretizeBetaFunction.cpp.o.d"
+  "/root/repo/src/core/functions/distribution/DiscretizeBetaQuadratureFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DiscretizeBetaQuadratureFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DiscretizeBetaQuadratureFunction.cpp.o.d"
+  "/root/repo/src/core/functions/distribution/DiscretizeDistributionFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DiscretizeDistributionFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DiscretizeDistributionFunction.cpp.o.d"
+  "/root/repo/src/core/functions/distribution/DiscretizeGammaFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DiscretizeGammaFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DiscretizeGammaFunction.cpp.o.d"
+  "/root/repo/src/core/functions/distribution/DiscretizeGammaQuadratureFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DiscretizeGammaQuadratureFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DiscretizeGammaQuadratureFunction.cpp.o.d"
+  "/root/repo/src/core/functions/distribution/DiscretizeLognormalQuadratureFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DiscretizeLognormalQuadratureFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DiscretizeLognormalQuadratureFunction.cpp.o.d"
+  "/root/repo/src/core/functions/distribution/PartialToCorrelationFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/PartialToCorrelationFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/PartialToCorrelationFunction.cpp.o.d"
+  "/root/repo/src/core/functions/distribution/QuantileFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/QuantileFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/QuantileFunction.cpp.o.d"
+  "/root/repo/src/core/functions/distribution/VarianceCovarianceFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/VarianceCovarianceFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/VarianceCovarianceFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/AbsoluteValueFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/AbsoluteValueFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/AbsoluteValueFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/AbsoluteValueVectorFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/AbsoluteValueVectorFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/AbsoluteValueVectorFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/AssembleOrder1ContinuousMRFFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/AssembleOrder1ContinuousMRFFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/AssembleOrder1ContinuousMRFFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/AssembleOrder2ContinuousMRFFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/AssembleOrder2ContinuousMRFFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/AssembleOrder2ContinuousMRFFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/CeilFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/CeilFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/CeilFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/ChooseFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/ChooseFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/ChooseFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/ContinuousFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/ContinuousFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/ContinuousFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/EmpiricalQuantileFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/EmpiricalQuantileFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/EmpiricalQuantileFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/ExponentialFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/ExponentialFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/ExponentialFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/FloorFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/FloorFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/FloorFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/GammaFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/GammaFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/GammaFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/GeographicalDistanceFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/GeographicalDistanceFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/GeographicalDistanceFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/HyperbolicSineFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/HyperbolicSineFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/HyperbolicSineFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/HyperbolicTangentFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/HyperbolicTangentFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/HyperbolicTangentFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/LnFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/LnFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/LnFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/LnProbabilityFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/LnProbabilityFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/LnProbabilityFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/LogFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/LogFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/LogFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/LogisticFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/LogisticFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/LogisticFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/MatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/MatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/MatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/PosteriorPredictiveProbabilityFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/PosteriorPredictiveProbabilityFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/PosteriorPredictiveProbabilityFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/PowerFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/PowerFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/PowerFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/PowerVectorFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/PowerVectorFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/PowerVectorFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/RoundFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/RoundFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/RoundFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/ShortestDistanceFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/ShortestDistanceFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/ShortestDistanceFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/SqrtFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/SqrtFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/SqrtFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/TruncateFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/TruncateFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/TruncateFunction.cpp.o.d"
+  "/root/repo/src/core/functions/math/UpperTriangle.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/UpperTriangle.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/UpperTriangle.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/CheckNodeOrderConstraintsFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/CheckNodeOrderConstraintsFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/CheckNodeOrderConstraintsFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/CladeSpecificHierarchicalBranchRateFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/CladeSpecificHierarchicalBranchRateFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/CladeSpecificHierarchicalBranchRateFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/CladogeneticSpeciationRateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/CladogeneticSpeciationRateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/CladogeneticSpeciationRateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/CoalaFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/CoalaFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/CoalaFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ComputeWeightedNodeOrderConstraintsScoreFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ComputeWeightedNodeOrderConstraintsScoreFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ComputeWeightedNodeOrderConstraintsScoreFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/DispersalExtinctionRateStructureFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/DispersalExtinctionRateStructureFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/DispersalExtinctionRateStructureFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/DispersalExtinctionRootStructureFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/DispersalExtinctionRootStructureFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/DispersalExtinctionRootStructureFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/MaximumTreeFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/MaximumTreeFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/MaximumTreeFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/PhyloDiversityFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/PhyloDiversityFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/PhyloDiversityFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/PhylogeneticIndependentContrastsFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/PhylogeneticIndependentContrastsFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/PhylogeneticIndependentContrastsFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/PhylogeneticIndependentContrastsMultiSampleFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/PhylogeneticIndependentContrastsMultiSampleFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/PhylogeneticIndependentContrastsMultiSampleFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/PruneTreeFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/PruneTreeFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/PruneTreeFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/RootedTripletDistributionFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/RootedTripletDistributionFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/RootedTripletDistributionFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/StitchTreeFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/StitchTreeFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/StitchTreeFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/TreeAssemblyFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/TreeAssemblyFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/TreeAssemblyFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/TreeScaleFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/TreeScaleFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/TreeScaleFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/cladogenetic/BiogeographyCladogeneticBirthDeathFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/BiogeographyCladogeneticBirthDeathFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/BiogeographyCladogeneticBirthDeathFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/cladogenetic/ChromosomesCladogenicBirthDeathFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/ChromosomesCladogenicBirthDeathFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/ChromosomesCladogenicBirthDeathFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/cladogenetic/ChromosomesCladogenicStateFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/ChromosomesCladogenicStateFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/ChromosomesCladogenicStateFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/cladogenetic/ChromosomesPloidyCladogenicBirthDeathFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/ChromosomesPloidyCladogenicBirthDeathFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/ChromosomesPloidyCladogenicBirthDeathFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/cladogenetic/DECCladogeneticStateFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/DECCladogeneticStateFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/DECCladogeneticStateFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/cladogenetic/EpochCladogeneticStateFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/EpochCladogeneticStateFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/EpochCladogeneticStateFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/cladogenetic/MixtureCladogeneticStateFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/MixtureCladogeneticStateFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/MixtureCladogeneticStateFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratemap/AdjacentRateModifierFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/AdjacentRateModifierFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/AdjacentRateModifierFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratemap/BiogeographyRateGeneratorSequenceFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/BiogeographyRateGeneratorSequenceFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/BiogeographyRateGeneratorSequenceFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratemap/DistanceRateModifierFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/DistanceRateModifierFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/DistanceRateModifierFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratemap/GeneralRateGeneratorSequenceFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/GeneralRateGeneratorSequenceFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/GeneralRateGeneratorSequenceFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratemap/HostSwitchRateModifierFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/HostSwitchRateModifierFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/HostSwitchRateModifierFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratemap/RangeEvolutionRateModifierFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/RangeEvolutionRateModifierFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/RangeEvolutionRateModifierFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratemap/SiteRateModifierFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/SiteRateModifierFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/SiteRateModifierFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratemap/StateCountRateModifierFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/StateCountRateModifierFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/StateCountRateModifierFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/ChromosomesPloidyRateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/ChromosomesPloidyRateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/ChromosomesPloidyRateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/ChromosomesRateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/ChromosomesRateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/ChromosomesRateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/CodonSynonymousNonsynonymousHKYRateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/CodonSynonymousNonsynonymousHKYRateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/CodonSynonymousNonsynonymousHKYRateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/CodonSynonymousNonsynonymousRateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/CodonSynonymousNonsynonymousRateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/CodonSynonymousNonsynonymousRateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/CovarionFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/CovarionFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/CovarionFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/CovarionRateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/CovarionRateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/CovarionRateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/DECRateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/DECRateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/DECRateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/DECStationaryFrequenciesFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/DECStationaryFrequenciesFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/DECStationaryFrequenciesFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/EpochRateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/EpochRateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/EpochRateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/F81RateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/F81RateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/F81RateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/FreeBinaryRateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/FreeBinaryRateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/FreeBinaryRateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/FreeKRateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/FreeKRateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/FreeKRateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/FreeSymmetricRateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/FreeSymmetricRateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/FreeSymmetricRateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/GtrRateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/GtrRateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/GtrRateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/HiddenStateRateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/HiddenStateRateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/HiddenStateRateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/HkyRateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/HkyRateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/HkyRateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/InfiniteSitesRateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/InfiniteSitesRateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/InfiniteSitesRateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/JcRateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/JcRateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/JcRateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/K80RateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/K80RateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/K80RateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/Kimura81RateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/Kimura81RateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/Kimura81RateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/OrderedRateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/OrderedRateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/OrderedRateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/PoMoRateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/PoMoRateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/PoMoRateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/PoMoRootFrequenciesFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/PoMoRootFrequenciesFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/PoMoRootFrequenciesFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/ReversiblePoMoRateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/ReversiblePoMoRateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/ReversiblePoMoRateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/SampledCladogenesisRootFrequenciesFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/SampledCladogenesisRootFrequenciesFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/SampledCladogenesisRootFrequenciesFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/T92RateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/T92RateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/T92RateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/TamuraNeiRateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/TamuraNeiRateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/TamuraNeiRateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/TimRateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/TimRateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/TimRateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/TvmRateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/TvmRateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/TvmRateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/ratematrix/WagRateMatrixFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/WagRateMatrixFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/WagRateMatrixFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/tree/ChronoToPhyloFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/tree/ChronoToPhyloFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/tree/ChronoToPhyloFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/tree/EarlyBurstRatesFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/tree/EarlyBurstRatesFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/tree/EarlyBurstRatesFunction.cpp.o.d"
+  "/root/repo/src/core/functions/phylogenetics/tree/ExtantTreeFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/tree/ExtantTreeFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/tree/ExtantTreeFunction.cpp.o.d"
+  "/root/repo/src/core/functions/popgen/PattersonsDFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/popgen/PattersonsDFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/popgen/PattersonsDFunction.cpp.o.d"
+  "/root/repo/src/core/functions/popgen/SegregatingSitesFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/popgen/SegregatingSitesFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/popgen/SegregatingSitesFunction.cpp.o.d"
+  "/root/repo/src/core/functions/popgen/TajimasDFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/popgen/TajimasDFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/popgen/TajimasDFunction.cpp.o.d"
+  "/root/repo/src/core/functions/popgen/TajimasPiFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/popgen/TajimasPiFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/popgen/TajimasPiFunction.cpp.o.d"
+  "/root/repo/src/core/functions/popgen/WattersonThetaFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/popgen/WattersonThetaFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/popgen/WattersonThetaFunction.cpp.o.d"
+  "/root/repo/src/core/functions/vector/SimplexFromVectorFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/vector/SimplexFromVectorFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/vector/SimplexFromVectorFunction.cpp.o.d"
+  "/root/repo/src/core/functions/vector/SimplexFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/vector/SimplexFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/vector/SimplexFunction.cpp.o.d"
+  "/root/repo/src/core/functions/vector/SimplexScaleFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/vector/SimplexScaleFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/vector/SimplexScaleFunction.cpp.o.d"
+  "/root/repo/src/core/functions/vector/SortVectorFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/vector/SortVectorFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/vector/SortVectorFunction.cpp.o.d"
+  "/root/repo/src/core/functions/vector/VectorFlattenFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/vector/VectorFlattenFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/functions/vector/VectorFlattenFunction.cpp.o.d"
+  "/root/repo/src/core/help/RbHelpArgument.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpArgument.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpArgument.cpp.o.d"
+  "/root/repo/src/core/help/RbHelpDistribution.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpDistribution.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpDistribution.cpp.o.d"
+  "/root/repo/src/core/help/RbHelpEntry.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpEntry.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpEntry.cpp.o.d"
+  "/root/repo/src/core/help/RbHelpFunction.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpFunction.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpFunction.cpp.o.d"
+  "/root/repo/src/core/help/RbHelpMonitor.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpMonitor.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpMonitor.cpp.o.d"
+  "/root/repo/src/core/help/RbHelpMove.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpMove.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpMove.cpp.o.d"
+  "/root/repo/src/core/help/RbHelpReference.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpReference.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpReference.cpp.o.d"
+  "/root/repo/src/core/help/RbHelpRenderer.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpRenderer.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpRenderer.cpp.o.d"
+  "/root/repo/src/core/help/RbHelpSystem.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpSystem.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpSystem.cpp.o.d"
+  "/root/repo/src/core/help/RbHelpType.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpType.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpType.cpp.o.d"
+  "/root/repo/src/core/io/BitsetCharacterDataConverter.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/BitsetCharacterDataConverter.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/BitsetCharacterDataConverter.cpp.o.d"
+  "/root/repo/src/core/io/BranchLengthDistributionReader.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/BranchLengthDistributionReader.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/BranchLengthDistributionReader.cpp.o.d"
+  "/root/repo/src/core/io/DelimitedCharacterDataReader.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/DelimitedCharacterDataReader.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/DelimitedCharacterDataReader.cpp.o.d"
+  "/root/repo/src/core/io/DelimitedCharacterDataWriter.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/DelimitedCharacterDataWriter.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/DelimitedCharacterDataWriter.cpp.o.d"
+  "/root/repo/src/core/io/DelimitedDataReader.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/DelimitedDataReader.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/DelimitedDataReader.cpp.o.d"
+  "/root/repo/src/core/io/DistanceMatrixReader.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/DistanceMatrixReader.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/DistanceMatrixReader.cpp.o.d"
+  "/root/repo/src/core/io/FastaWriter.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/FastaWriter.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/FastaWriter.cpp.o.d"
+  "/root/repo/src/core/io/MatrixReader.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/MatrixReader.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/MatrixReader.cpp.o.d"
+  "/root/repo/src/core/io/NclReader.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/NclReader.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/NclReader.cpp.o.d"
+  "/root/repo/src/core/io/NewickConverter.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/NewickConverter.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/NewickConverter.cpp.o.d"
+  "/root/repo/src/core/io/NewickTreeReader.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/NewickTreeReader.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/NewickTreeReader.cpp.o.d"
+  "/root/repo/src/core/io/NexusWriter.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/NexusWriter.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/NexusWriter.cpp.o.d"
+  "/root/repo/src/core/io/PhylowoodConverter.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/PhylowoodConverter.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/PhylowoodConverter.cpp.o.d"
+  "/root/repo/src/core/io/PoMoCountFileReader.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/PoMoCountFileReader.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/PoMoCountFileReader.cpp.o.d"
+  "/root/repo/src/core/io/PoMoState4Converter.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/PoMoState4Converter.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/PoMoState4Converter.cpp.o.d"
+  "/root/repo/src/core/io/ProgressBar.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/ProgressBar.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/ProgressBar.cpp.o.d"
+  "/root/repo/src/core/io/RelativeNodeAgeConstraintsReader.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/RelativeNodeAgeConstraintsReader.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/RelativeNodeAgeConstraintsReader.cpp.o.d"
+  "/root/repo/src/core/io/RelativeNodeAgeWeightedConstraintsReader.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/RelativeNodeAgeWeightedConstraintsReader.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/RelativeNodeAgeWeightedConstraintsReader.cpp.o.d"
+  "/root/repo/src/core/io/TaxonReader.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/TaxonReader.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/TaxonReader.cpp.o.d"
+  "/root/repo/src/core/io/TimeAtlasDataReader.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/TimeAtlasDataReader.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/TimeAtlasDataReader.cpp.o.d"
+  "/root/repo/src/core/io/TraceContinuousReader.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/TraceContinuousReader.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/TraceContinuousReader.cpp.o.d"
+  "/root/repo/src/core/io/TraceReader.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/TraceReader.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/io/TraceReader.cpp.o.d"
+  "/root/repo/src/core/math/CholeskyDecomposition.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/CholeskyDecomposition.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/CholeskyDecomposition.cpp.o.d"
+  "/root/repo/src/core/math/EigenSystem.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/EigenSystem.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/EigenSystem.cpp.o.d"
+  "/root/repo/src/core/math/RandomNumberFactory.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/RandomNumberFactory.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/RandomNumberFactory.cpp.o.d"
+  "/root/repo/src/core/math/RandomNumberGenerator.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/RandomNumberGenerator.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/RandomNumberGenerator.cpp.o.d"
+  "/root/repo/src/core/math/RbMathCombinatorialFunctions.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathCombinatorialFunctions.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathCombinatorialFunctions.cpp.o.d"
+  "/root/repo/src/core/math/RbMathFunctions.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathFunctions.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathFunctions.cpp.o.d"
+  "/root/repo/src/core/math/RbMathGaussianElimination.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathGaussianElimination.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathGaussianElimination.cpp.o.d"
+  "/root/repo/src/core/math/RbMathHelper.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathHelper.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathHelper.cpp.o.d"
+  "/root/repo/src/core/math/RbMathLogic.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathLogic.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathLogic.cpp.o.d"
+  "/root/repo/src/core/math/RbMathMatrix.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathMatrix.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathMatrix.cpp.o.d"
+  "/root/repo/src/core/math/RbMathVector.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathVector.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathVector.cpp.o.d"
+  "/root/repo/src/core/math/RbStatisticsHelper.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/RbStatisticsHelper.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/RbStatisticsHelper.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionBeta.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionBeta.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionBeta.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionBinomial.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionBinomial.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionBinomial.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionBivariatePoisson.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionBivariatePoisson.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionBivariatePoisson.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionCauchy.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionCauchy.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionCauchy.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionChisq.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionChisq.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionChisq.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionCompoundPoissonNormal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionCompoundPoissonNormal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionCompoundPoissonNormal.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionDecomposedInverseWishart.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionDecomposedInverseWishart.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionDecomposedInverseWishart.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionDirichlet.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionDirichlet.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionDirichlet.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionExponential.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionExponential.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionExponential.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionF.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionF.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionF.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionGamma.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionGamma.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionGamma.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionGeometric.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionGeometric.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionGeometric.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionGilbertGraph.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionGilbertGraph.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionGilbertGraph.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionHalfCauchy.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionHalfCauchy.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionHalfCauchy.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionInverseGamma.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionInverseGamma.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionInverseGamma.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionInverseWishart.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionInverseWishart.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionInverseWishart.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionLKJ.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionLKJ.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionLKJ.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionLaplace.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionLaplace.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionLaplace.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionLogistic.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionLogistic.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionLogistic.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionLognormal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionLognormal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionLognormal.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionMultinomial.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionMultinomial.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionMultinomial.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionMultivariateNormal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionMultivariateNormal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionMultivariateNormal.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionNegativeBinomial.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionNegativeBinomial.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionNegativeBinomial.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionNormal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionNormal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionNormal.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionPoisson.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionPoisson.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionPoisson.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionScaledDirichlet.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionScaledDirichlet.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionScaledDirichlet.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionStudentT.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionStudentT.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionStudentT.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionUniform.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionUniform.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionUniform.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionVarianceGamma.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionVarianceGamma.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionVarianceGamma.cpp.o.d"
+  "/root/repo/src/core/math/distributions/DistributionWishart.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionWishart.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionWishart.cpp.o.d"
+  "/root/repo/src/core/monitors/AbstractFileMonitor.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/AbstractFileMonitor.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/AbstractFileMonitor.cpp.o.d"
+  "/root/repo/src/core/monitors/ExtendedNewickTreeMonitor.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/ExtendedNewickTreeMonitor.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/ExtendedNewickTreeMonitor.cpp.o.d"
+  "/root/repo/src/core/monitors/ModelMonitor.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/ModelMonitor.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/ModelMonitor.cpp.o.d"
+  "/root/repo/src/core/monitors/Monitor.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/Monitor.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/Monitor.cpp.o.d"
+  "/root/repo/src/core/monitors/NexusMonitor.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/NexusMonitor.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/NexusMonitor.cpp.o.d"
+  "/root/repo/src/core/monitors/ProbabilityMonitor.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/ProbabilityMonitor.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/ProbabilityMonitor.cpp.o.d"
+  "/root/repo/src/core/monitors/ScreenMonitor.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/ScreenMonitor.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/ScreenMonitor.cpp.o.d"
+  "/root/repo/src/core/monitors/StochasticBranchRateMonitor.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/StochasticBranchRateMonitor.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/StochasticBranchRateMonitor.cpp.o.d"
+  "/root/repo/src/core/monitors/StochasticBranchStateTimesMonitor.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/StochasticBranchStateTimesMonitor.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/StochasticBranchStateTimesMonitor.cpp.o.d"
+  "/root/repo/src/core/monitors/StochasticVariableMonitor.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/StochasticVariableMonitor.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/StochasticVariableMonitor.cpp.o.d"
+  "/root/repo/src/core/monitors/VariableMonitor.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/VariableMonitor.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/VariableMonitor.cpp.o.d"
+  "/root/repo/src/core/monitors/characterhistory/CharacterHistoryNodeMonitor.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/characterhistory/CharacterHistoryNodeMonitor.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/characterhistory/CharacterHistoryNodeMonitor.cpp.o.d"
+  "/root/repo/src/core/monitors/characterhistory/CharacterHistoryPosteriorPredictiveMonitor.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/characterhistory/CharacterHistoryPosteriorPredictiveMonitor.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/characterhistory/CharacterHistoryPosteriorPredictiveMonitor.cpp.o.d"
+  "/root/repo/src/core/monitors/characterhistory/PhylowoodNhxMonitor.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/characterhistory/PhylowoodNhxMonitor.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/monitors/characterhistory/PhylowoodNhxMonitor.cpp.o.d"
+  "/root/repo/src/core/moves/AbstractGibbsMove.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/AbstractGibbsMove.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/AbstractGibbsMove.cpp.o.d"
+  "/root/repo/src/core/moves/AbstractMove.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/AbstractMove.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/AbstractMove.cpp.o.d"
+  "/root/repo/src/core/moves/EllipticalSliceSamplingLognormalIIDMove.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/EllipticalSliceSamplingLognormalIIDMove.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/EllipticalSliceSamplingLognormalIIDMove.cpp.o.d"
+  "/root/repo/src/core/moves/EllipticalSliceSamplingSimpleMove.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/EllipticalSliceSamplingSimpleMove.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/EllipticalSliceSamplingSimpleMove.cpp.o.d"
+  "/root/repo/src/core/moves/MetropolisHastingsMove.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/MetropolisHastingsMove.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/MetropolisHastingsMove.cpp.o.d"
+  "/root/repo/src/core/moves/Move.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/Move.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/Move.cpp.o.d"
+  "/root/repo/src/core/moves/MoveSchedule.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/MoveSchedule.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/MoveSchedule.cpp.o.d"
+  "/root/repo/src/core/moves/PseudoGibbsMetaMove.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/PseudoGibbsMetaMove.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/PseudoGibbsMetaMove.cpp.o.d"
+  "/root/repo/src/core/moves/RandomMoveSchedule.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/RandomMoveSchedule.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/RandomMoveSchedule.cpp.o.d"
+  "/root/repo/src/core/moves/SequentialMoveSchedule.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/SequentialMoveSchedule.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/SequentialMoveSchedule.cpp.o.d"
+  "/root/repo/src/core/moves/SingleRandomMoveSchedule.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/SingleRandomMoveSchedule.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/SingleRandomMoveSchedule.cpp.o.d"
+  "/root/repo/src/core/moves/SliceSamplingMove.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/SliceSamplingMove.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/SliceSamplingMove.cpp.o.d"
+  "/root/repo/src/core/moves/characterhistory/ContinuousEventBirthDeathProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/ContinuousEventBirthDeathProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/ContinuousEventBirthDeathProposal.cpp.o.d"
+  "/root/repo/src/core/moves/characterhistory/ContinuousEventScaleProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/ContinuousEventScaleProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/ContinuousEventScaleProposal.cpp.o.d"
+  "/root/repo/src/core/moves/characterhistory/DiscreteEventBirthDeathProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/DiscreteEventBirthDeathProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/DiscreteEventBirthDeathProposal.cpp.o.d"
+  "/root/repo/src/core/moves/characterhistory/DiscreteEventCategoryRandomWalkProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/DiscreteEventCategoryRandomWalkProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/DiscreteEventCategoryRandomWalkProposal.cpp.o.d"
+  "/root/repo/src/core/moves/characterhistory/EventBirthDeathFromAgeProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/EventBirthDeathFromAgeProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/EventBirthDeathFromAgeProposal.cpp.o.d"
+  "/root/repo/src/core/moves/characterhistory/EventBirthDeathProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/EventBirthDeathProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/EventBirthDeathProposal.cpp.o.d"
+  "/root/repo/src/core/moves/characterhistory/EventBranchTimeBetaProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/EventBranchTimeBetaProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/EventBranchTimeBetaProposal.cpp.o.d"
+  "/root/repo/src/core/moves/characterhistory/EventTimeSlideProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/EventTimeSlideProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/EventTimeSlideProposal.cpp.o.d"
+  "/root/repo/src/core/moves/characterhistory/GibbsDrawCharacterHistoryProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/GibbsDrawCharacterHistoryProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/GibbsDrawCharacterHistoryProposal.cpp.o.d"
+  "/root/repo/src/core/moves/compound/ConjugateInverseWishartMove.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/compound/ConjugateInverseWishartMove.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/compound/ConjugateInverseWishartMove.cpp.o.d"
+  "/root/repo/src/core/moves/compound/CorrelationMatrixReparameterizationMove.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/compound/CorrelationMatrixReparameterizationMove.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/compound/CorrelationMatrixReparameterizationMove.cpp.o.d"
+  "/root/repo/src/core/moves/compound/RateAgeBetaShift.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/compound/RateAgeBetaShift.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/compound/RateAgeBetaShift.cpp.o.d"
+  "/root/repo/src/core/moves/mixture/DPPGibbsConcentrationMove.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/mixture/DPPGibbsConcentrationMove.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/mixture/DPPGibbsConcentrationMove.cpp.o.d"
+  "/root/repo/src/core/moves/mixture/MultiValueEventBirthDeathProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/mixture/MultiValueEventBirthDeathProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/mixture/MultiValueEventBirthDeathProposal.cpp.o.d"
+  "/root/repo/src/core/moves/mixture/MultiValueEventScaleProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/mixture/MultiValueEventScaleProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/mixture/MultiValueEventScaleProposal.cpp.o.d"
+  "/root/repo/src/core/moves/mixture/MultiValueEventSlideProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/mixture/MultiValueEventSlideProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/mixture/MultiValueEventSlideProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/AVMVNProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/AVMVNProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/AVMVNProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/ContinuousCharacterDataScaleProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/ContinuousCharacterDataScaleProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/ContinuousCharacterDataScaleProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/ContinuousCharacterDataSlideProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/ContinuousCharacterDataSlideProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/ContinuousCharacterDataSlideProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/Proposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/Proposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/Proposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/UpDownScaleProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/UpDownScaleProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/UpDownScaleProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/UpDownSlideBactrianProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/UpDownSlideBactrianProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/UpDownSlideBactrianProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/UpDownSlideProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/UpDownSlideProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/UpDownSlideProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixElementBetaProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixElementBetaProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixElementBetaProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixElementSwapProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixElementSwapProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixElementSwapProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixExpansionProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixExpansionProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixExpansionProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixPartialElementBetaProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixPartialElementBetaProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixPartialElementBetaProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixRandomWalkProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixRandomWalkProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixRandomWalkProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixSpecificElementBetaProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixSpecificElementBetaProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixSpecificElementBetaProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/matrix/GraphFlipCliqueProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/GraphFlipCliqueProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/GraphFlipCliqueProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/matrix/GraphFlipEdgeProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/GraphFlipEdgeProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/GraphFlipEdgeProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/matrix/GraphShiftEdgeProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/GraphShiftEdgeProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/GraphShiftEdgeProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/matrix/MatrixRealSingleElementScaleProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/MatrixRealSingleElementScaleProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/MatrixRealSingleElementScaleProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/matrix/MatrixRealSingleElementSlideProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/MatrixRealSingleElementSlideProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/MatrixRealSingleElementSlideProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/matrix/MatrixRealSymmetricSingleElementSlidingProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/MatrixRealSymmetricSingleElementSlidingProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/MatrixRealSymmetricSingleElementSlidingProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/scalar/BetaProbabilityProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/BetaProbabilityProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/BetaProbabilityProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/scalar/BinarySwitchProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/BinarySwitchProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/BinarySwitchProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/scalar/GMRFHyperpriorGibbsMove.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/GMRFHyperpriorGibbsMove.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/GMRFHyperpriorGibbsMove.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/scalar/GMRFOrder2HyperpriorGibbsMove.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/GMRFOrder2HyperpriorGibbsMove.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/GMRFOrder2HyperpriorGibbsMove.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/scalar/GMRFUnevenGridHyperpriorGibbsMove.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/GMRFUnevenGridHyperpriorGibbsMove.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/GMRFUnevenGridHyperpriorGibbsMove.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/scalar/GammaScaleProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/GammaScaleProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/GammaScaleProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/scalar/HalfRandomDiveProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/HalfRandomDiveProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/HalfRandomDiveProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/scalar/LevyJumpProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/LevyJumpProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/LevyJumpProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/scalar/LevyJumpSumProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/LevyJumpSumProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/LevyJumpSumProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/scalar/MirrorMultiplierProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/MirrorMultiplierProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/MirrorMultiplierProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/scalar/MirrorProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/MirrorProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/MirrorProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/scalar/RandomDiveProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/RandomDiveProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/RandomDiveProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/scalar/RandomGeometricWalkProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/RandomGeometricWalkProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/RandomGeometricWalkProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/scalar/RandomIntegerWalkProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/RandomIntegerWalkProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/RandomIntegerWalkProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/scalar/ScaleBactrianCauchyProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/ScaleBactrianCauchyProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/ScaleBactrianCauchyProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/scalar/ScaleBactrianProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/ScaleBactrianProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/ScaleBactrianProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/scalar/ScaleProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/ScaleProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/ScaleProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/scalar/ScaleProposalContinuous.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/ScaleProposalContinuous.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/ScaleProposalContinuous.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/scalar/ScaleUpDownProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/ScaleUpDownProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/ScaleUpDownProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/scalar/SlideBactrianProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/SlideBactrianProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/SlideBactrianProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/scalar/SlideBactrianProposalContinuous.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/SlideBactrianProposalContinuous.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/SlideBactrianProposalContinuous.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/scalar/SlideProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/SlideProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/SlideProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/scalar/SlideProposalContinuous.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/SlideProposalContinuous.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/SlideProposalContinuous.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/scalar/SlideUpDownProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/SlideUpDownProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/SlideUpDownProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/simplex/BetaSimplexProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/simplex/BetaSimplexProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/simplex/BetaSimplexProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/simplex/DirichletSimplexProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/simplex/DirichletSimplexProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/simplex/DirichletSimplexProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/simplex/ElementSwapSimplexProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/simplex/ElementSwapSimplexProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/simplex/ElementSwapSimplexProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/AddRemoveTipProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/AddRemoveTipProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/AddRemoveTipProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/BranchLengthScaleProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/BranchLengthScaleProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/BranchLengthScaleProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/BurstEventProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/BurstEventProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/BurstEventProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/CollapseExpandFossilBranchProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/CollapseExpandFossilBranchProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/CollapseExpandFossilBranchProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/EmpiricalTreeTopologyProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/EmpiricalTreeTopologyProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/EmpiricalTreeTopologyProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/FixedNodeheightPruneAndRegraftProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/FixedNodeheightPruneAndRegraftProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/FixedNodeheightPruneAndRegraftProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/GibbsPruneAndRegraftProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/GibbsPruneAndRegraftProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/GibbsPruneAndRegraftProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/IndependentTopologyProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/IndependentTopologyProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/IndependentTopologyProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/LayeredScaleProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/LayeredScaleProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/LayeredScaleProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/NarrowExchangeProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NarrowExchangeProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NarrowExchangeProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/NarrowExchangeRateMatrixProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NarrowExchangeRateMatrixProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NarrowExchangeRateMatrixProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/NearestNeighborInterchangeProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NearestNeighborInterchangeProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NearestNeighborInterchangeProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/NearestNeighborInterchange_nonClockProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NearestNeighborInterchange_nonClockProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NearestNeighborInterchange_nonClockProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/NodeRateTimeSlideUniformProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeRateTimeSlideUniformProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeRateTimeSlideUniformProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/NodeTimeScaleProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeScaleProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeScaleProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/NodeTimeSlideBetaProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeSlideBetaProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeSlideBetaProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/NodeTimeSlidePathTruncatedNormalProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeSlidePathTruncatedNormalProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeSlidePathTruncatedNormalProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/NodeTimeSlideUniformAgeConstrainedProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeSlideUniformAgeConstrainedProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeSlideUniformAgeConstrainedProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/NodeTimeSlideUniformCharacterHistoryProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeSlideUniformCharacterHistoryProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeSlideUniformCharacterHistoryProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/NodeTimeSlideUniformProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeSlideUniformProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeSlideUniformProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/NodeTimeSlideWeightedProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeSlideWeightedProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeSlideWeightedProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/RootTimeScaleBactrianProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/RootTimeScaleBactrianProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/RootTimeScaleBactrianProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/RootTimeSlideUniformProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/RootTimeSlideUniformProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/RootTimeSlideUniformProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/SpeciesNarrowExchangeProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SpeciesNarrowExchangeProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SpeciesNarrowExchangeProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/SpeciesSubtreeScaleBetaProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SpeciesSubtreeScaleBetaProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SpeciesSubtreeScaleBetaProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/SpeciesSubtreeScaleProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SpeciesSubtreeScaleProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SpeciesSubtreeScaleProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/SpeciesTreeNodeSlideProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SpeciesTreeNodeSlideProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SpeciesTreeNodeSlideProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/SpeciesTreeScaleProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SpeciesTreeScaleProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SpeciesTreeScaleProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/SubtreePruneRegraftProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SubtreePruneRegraftProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SubtreePruneRegraftProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/SubtreeScaleProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SubtreeScaleProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SubtreeScaleProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/TipTimeSlideUniformProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/TipTimeSlideUniformProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/TipTimeSlideUniformProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/TreeNodeAgeUpdateProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/TreeNodeAgeUpdateProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/TreeNodeAgeUpdateProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/tree/TreeScaleProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/TreeScaleProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/TreeScaleProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/vector/ElementScaleProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/ElementScaleProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/ElementScaleProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/vector/ElementSlideProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/ElementSlideProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/ElementSlideProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/vector/HSRFHyperpriorsGibbsMove.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/HSRFHyperpriorsGibbsMove.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/HSRFHyperpriorsGibbsMove.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/vector/HSRFOrder2HyperpriorsGibbsMove.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/HSRFOrder2HyperpriorsGibbsMove.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/HSRFOrder2HyperpriorsGibbsMove.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/vector/HSRFUnevenGridHyperpriorsGibbsMove.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/HSRFUnevenGridHyperpriorsGibbsMove.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/HSRFUnevenGridHyperpriorsGibbsMove.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/vector/MultipleElementScaleProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/MultipleElementScaleProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/MultipleElementScaleProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/vector/ShrinkExpandProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/ShrinkExpandProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/ShrinkExpandProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/vector/ShrinkExpandScaleProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/ShrinkExpandScaleProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/ShrinkExpandScaleProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/vector/SingleElementScaleProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/SingleElementScaleProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/SingleElementScaleProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/vector/SingleElementSlideProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/SingleElementSlideProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/SingleElementSlideProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/vector/SynchronizedVectorFixedSingleElementSlideProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/SynchronizedVectorFixedSingleElementSlideProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/SynchronizedVectorFixedSingleElementSlideProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/vector/VectorBinarySwitchProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorBinarySwitchProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorBinarySwitchProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/vector/VectorFixedSingleElementSlideProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorFixedSingleElementSlideProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorFixedSingleElementSlideProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/vector/VectorScaleProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorScaleProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorScaleProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/vector/VectorSingleElementScaleProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorSingleElementScaleProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorSingleElementScaleProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/vector/VectorSingleElementSlideProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorSingleElementSlideProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorSingleElementSlideProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/vector/VectorSlideProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorSlideProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorSlideProposal.cpp.o.d"
+  "/root/repo/src/core/moves/proposal/vector/VectorSlideRecenterProposal.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorSlideRecenterProposal.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorSlideRecenterProposal.cpp.o.d"
+  "/root/repo/src/core/statistics/mixture/MeanVecContinuousValStatistic.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/statistics/mixture/MeanVecContinuousValStatistic.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/statistics/mixture/MeanVecContinuousValStatistic.cpp.o.d"
+  "/root/repo/src/core/statistics/mixture/VectorDoubleProductStatistic.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/statistics/mixture/VectorDoubleProductStatistic.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/statistics/mixture/VectorDoubleProductStatistic.cpp.o.d"
+  "/root/repo/src/core/statistics/tree/BranchScoreDistanceStatistic.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/BranchScoreDistanceStatistic.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/BranchScoreDistanceStatistic.cpp.o.d"
+  "/root/repo/src/core/statistics/tree/MrcaIndexStatistic.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/MrcaIndexStatistic.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/MrcaIndexStatistic.cpp.o.d"
+  "/root/repo/src/core/statistics/tree/NodeAgeByID.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/NodeAgeByID.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/NodeAgeByID.cpp.o.d"
+  "/root/repo/src/core/statistics/tree/SymmetricDifferenceStatistic.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/SymmetricDifferenceStatistic.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/SymmetricDifferenceStatistic.cpp.o.d"
+  "/root/repo/src/core/statistics/tree/TmrcaStatistic.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/TmrcaStatistic.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/TmrcaStatistic.cpp.o.d"
+  "/root/repo/src/core/statistics/tree/TreeBipartitions.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/TreeBipartitions.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/TreeBipartitions.cpp.o.d"
+  "/root/repo/src/core/statistics/tree/TreeLengthStatistic.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/TreeLengthStatistic.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/TreeLengthStatistic.cpp.o.d"
+  "/root/repo/src/core/statistics/tree/TreePairwiseDistances.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/TreePairwiseDistances.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/TreePairwiseDistances.cpp.o.d"
+  "/root/repo/src/core/statistics/tree/TreePairwiseNodalDistances.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/TreePairwiseNodalDistances.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/TreePairwiseNodalDistances.cpp.o.d"
+  "/root/repo/src/core/utils/AlignedArena.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/utils/AlignedArena.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/utils/AlignedArena.cpp.o.d"
+  "/root/repo/src/core/utils/BirthDeathForwardSimulator.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/utils/BirthDeathForwardSimulator.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/utils/BirthDeathForwardSimulator.cpp.o.d"
+  "/root/repo/src/core/utils/MpiUtilities.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/utils/MpiUtilities.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/utils/MpiUtilities.cpp.o.d"
+  "/root/repo/src/core/utils/RbException.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/utils/RbException.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/utils/RbException.cpp.o.d"
+  "/root/repo/src/core/utils/RbFileManager.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/utils/RbFileManager.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/utils/RbFileManager.cpp.o.d"
+  "/root/repo/src/core/utils/RbSettings.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/utils/RbSettings.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/utils/RbSettings.cpp.o.d"
+  "/root/repo/src/core/utils/RbUtil.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/utils/RbUtil.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/utils/RbUtil.cpp.o.d"
+  "/root/repo/src/core/utils/StartingTreeSimulator.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/utils/StartingTreeSimulator.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/utils/StartingTreeSimulator.cpp.o.d"
+  "/root/repo/src/core/utils/StringUtilities.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/utils/StringUtilities.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/utils/StringUtilities.cpp.o.d"
+  "/root/repo/src/core/utils/ThreadPool.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/utils/ThreadPool.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/utils/ThreadPool.cpp.o.d"
+  "/root/repo/src/core/utils/TreeUtilities.cpp" "core/CMakeFiles/rb-core.dir/root/repo/src/core/utils/TreeUtilities.cpp.o" "gcc" "core/CMakeFiles/rb-core.dir/root/repo/src/core/utils/TreeUtilities.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
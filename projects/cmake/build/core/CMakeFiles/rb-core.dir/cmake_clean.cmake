@@ -0,0 +1,1291 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/BootstrapAnalysis.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/BootstrapAnalysis.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/HillClimber.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/HillClimber.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/MaximumLikelihoodAnalysis.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/MaximumLikelihoodAnalysis.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/MaximumLikelihoodEstimation.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/MaximumLikelihoodEstimation.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/Model.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/Model.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/MonteCarloAnalysis.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/MonteCarloAnalysis.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/PosteriorPredictiveAnalysis.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/PosteriorPredictiveAnalysis.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/PosteriorPredictiveSimulation.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/PosteriorPredictiveSimulation.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/PowerPosteriorAnalysis.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/PowerPosteriorAnalysis.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/ValidationAnalysis.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/ValidationAnalysis.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/MarginalLikelihoodEstimator.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/MarginalLikelihoodEstimator.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/Mcmc.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/Mcmc.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/Mcmcmc.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/Mcmcmc.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/MonteCarloSampler.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/MonteCarloSampler.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/PathSampler.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/PathSampler.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/SteppingStoneSampler.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/SteppingStoneSampler.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/WangLandauMcmc.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/WangLandauMcmc.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/EssMax.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/EssMax.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/EssTest.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/EssTest.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/GelmanRubinTest.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/GelmanRubinTest.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/GewekeTest.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/GewekeTest.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/HeidelbergerWelchTest.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/HeidelbergerWelchTest.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/SemMin.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/SemMin.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/StationarityTest.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/StationarityTest.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/TraceAccumulator.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/TraceAccumulator.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/TraceAccumulatorRegistry.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/convergence/TraceAccumulatorRegistry.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/output/JointAncestralStateTrace.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/output/JointAncestralStateTrace.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/output/Trace.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/output/Trace.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/output/TraceNumeric.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/output/TraceNumeric.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/output/TraceTree.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/mcmc/output/TraceTree.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/AbstractConvergenceStoppingRule.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/AbstractConvergenceStoppingRule.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/GelmanRubinStoppingRule.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/GelmanRubinStoppingRule.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/GewekeStoppingRule.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/GewekeStoppingRule.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/MaxIterationStoppingRule.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/MaxIterationStoppingRule.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/MaxTimeStoppingRule.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/MaxTimeStoppingRule.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/MinEssStoppingRule.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/MinEssStoppingRule.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/StationarityStoppingRule.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/StationarityStoppingRule.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/StoppingRule.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/analysis/stoppingRule/StoppingRule.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/dag/ContinuousStochasticNode.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/dag/ContinuousStochasticNode.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/dag/DagNode.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/dag/DagNode.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/DagNodeMap.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/DagNodeMap.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/MultiValueEvent.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/MultiValueEvent.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/Parallelizable.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/Parallelizable.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/RbBitSet.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/RbBitSet.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/RbBoolean.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/RbBoolean.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/Serializable.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/Serializable.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/CorrespondenceAnalysis.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/CorrespondenceAnalysis.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/DualityDiagram.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/DualityDiagram.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/MatrixComplex.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/MatrixComplex.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/MatrixReal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/MatrixReal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/Simplex.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/Simplex.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/TransitionProbabilityMatrix.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/TransitionProbabilityMatrix.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/TransitionProbabilityMatrixPool.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/math/TransitionProbabilityMatrixPool.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/DistanceMatrix.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/DistanceMatrix.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/RelativeNodeAgeConstraints.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/RelativeNodeAgeConstraints.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/RelativeNodeAgeWeightedConstraints.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/RelativeNodeAgeWeightedConstraints.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/Taxon.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/Taxon.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/TaxonMap.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/TaxonMap.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/TimeInterval.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/TimeInterval.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/TreeDiscreteCharacterData.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/TreeDiscreteCharacterData.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/AminoAcidState.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/AminoAcidState.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/BinaryState.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/BinaryState.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/CharacterState.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/CharacterState.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/CharacterTranslator.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/CharacterTranslator.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/CodonState.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/CodonState.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/DiscreteCharacterState.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/DiscreteCharacterState.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/DnaState.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/DnaState.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/NaturalNumbersState.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/NaturalNumbersState.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/PoMoState.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/PoMoState.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/PoMoState4.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/PoMoState4.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/RnaState.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/RnaState.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/StandardState.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/StandardState.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/TripletState.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/character/TripletState.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractCharacterData.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractCharacterData.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractDiscreteTaxonData.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractDiscreteTaxonData.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractHomologousDiscreteCharacterData.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractHomologousDiscreteCharacterData.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractNonHomologousDiscreteCharacterData.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractNonHomologousDiscreteCharacterData.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractTaxonData.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/AbstractTaxonData.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/ContinuousCharacterData.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/ContinuousCharacterData.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/ContinuousTaxonData.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/ContinuousTaxonData.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/HomologousCharacterData.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/HomologousCharacterData.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/NonHomologousCharacterData.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterdata/NonHomologousCharacterData.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/BranchHistory.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/BranchHistory.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/BranchHistoryContinuous.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/BranchHistoryContinuous.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/BranchHistoryDiscrete.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/BranchHistoryDiscrete.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterEvent.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterEvent.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterEventContinuous.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterEventContinuous.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterEventDiscrete.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterEventDiscrete.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterHistory.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterHistory.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterHistoryContinuous.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterHistoryContinuous.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterHistoryDiscrete.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/characterhistory/CharacterHistoryDiscrete.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/cladogeneticmatrix/CladogeneticProbabilityMatrix.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/cladogeneticmatrix/CladogeneticProbabilityMatrix.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/cladogeneticmatrix/CladogeneticProbabilityMatrix_Epoch.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/cladogeneticmatrix/CladogeneticProbabilityMatrix_Epoch.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/cladogeneticmatrix/CladogeneticSpeciationRateMatrix.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/cladogeneticmatrix/CladogeneticSpeciationRateMatrix.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/geography/GeographicArea.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/geography/GeographicArea.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/geography/TimeAtlas.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/geography/TimeAtlas.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/AdjacentRateModifier.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/AdjacentRateModifier.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/CharacterHistoryRateModifier.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/CharacterHistoryRateModifier.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/DistanceRateModifier.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/DistanceRateModifier.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/HostSwitchRateModifier.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/HostSwitchRateModifier.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/RangeEvolutionRateModifier.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/RangeEvolutionRateModifier.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/RateGeneratorSequence.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/RateGeneratorSequence.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/RateGeneratorSequenceUsingMatrix.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/RateGeneratorSequenceUsingMatrix.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/RateGeneratorSequence_Biogeography.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/RateGeneratorSequence_Biogeography.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/SiteRateModifier.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/SiteRateModifier.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/StateCountRateModifier.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratemap/StateCountRateModifier.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/AbstractRateMatrix.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/AbstractRateMatrix.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/GeneralRateMatrix.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/GeneralRateMatrix.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateGenerator.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateGenerator.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateGenerator_Epoch.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateGenerator_Epoch.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Blosum62.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Blosum62.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Chromosomes.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Chromosomes.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_ChromosomesPloidy.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_ChromosomesPloidy.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_CodonSynonymousNonsynonymous.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_CodonSynonymousNonsynonymous.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_CodonSynonymousNonsynonymousHKY.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_CodonSynonymousNonsynonymousHKY.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Covarion.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Covarion.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_CpRev.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_CpRev.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_DECRateMatrix.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_DECRateMatrix.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Dayhoff.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Dayhoff.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Empirical.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Empirical.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_F81.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_F81.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_FreeBinary.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_FreeBinary.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_FreeK.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_FreeK.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_FreeSymmetric.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_FreeSymmetric.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_GTR.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_GTR.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_HKY.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_HKY.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_InfiniteSites.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_InfiniteSites.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_JC.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_JC.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Jones.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Jones.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Kimura80.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Kimura80.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Kimura81.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Kimura81.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_LG.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_LG.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_MtMam.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_MtMam.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_MtRev24.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_MtRev24.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Ordered.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Ordered.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_PoMo.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_PoMo.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_PoMo.temp_caseinsensitive_rename.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_PoMo.temp_caseinsensitive_rename.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_PoMo4.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_PoMo4.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_ReversiblePoMo.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_ReversiblePoMo.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_RtRev.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_RtRev.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Senca.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Senca.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_TIM.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_TIM.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_TVM.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_TVM.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Tamura92.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Tamura92.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_TamuraNei.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_TamuraNei.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Vt.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Vt.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Wag.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/RateMatrix_Wag.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/TimeReversibleRateMatrix.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/phylogenetics/ratematrix/TimeReversibleRateMatrix.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/trees/Clade.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/trees/Clade.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/trees/RootedTripletDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/trees/RootedTripletDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/trees/TopologyNode.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/trees/TopologyNode.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/trees/Tree.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/trees/Tree.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/trees/TreeChangeEventHandler.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/datatypes/trees/TreeChangeEventHandler.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/Distribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/Distribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/MultiValueEventDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/MultiValueEventDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/BernoulliDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/BernoulliDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/BetaDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/BetaDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/BimodalLognormalDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/BimodalLognormalDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/BimodalNormalDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/BimodalNormalDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/BinomialDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/BinomialDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/BivariatePoissonDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/BivariatePoissonDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/CategoricalDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/CategoricalDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/CauchyDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/CauchyDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/ChisqDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/ChisqDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/CompoundPoissonNormalDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/CompoundPoissonNormalDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/ContinuousDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/ContinuousDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/DecomposedInverseWishartDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/DecomposedInverseWishartDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/DirichletDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/DirichletDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/ExponentialDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/ExponentialDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/ExponentialWithOffsetDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/ExponentialWithOffsetDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/GammaDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/GammaDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/GeometricDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/GeometricDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/GilbertGraphDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/GilbertGraphDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/HalfCauchyDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/HalfCauchyDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/HalfNormalDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/HalfNormalDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/InverseGammaDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/InverseGammaDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/InverseWishartDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/InverseWishartDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LKJDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LKJDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LKJPartialDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LKJPartialDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LaplaceDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LaplaceDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LogExponentialDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LogExponentialDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LogUniformDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LogUniformDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LognormalDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LognormalDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LognormalWithOffsetDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/LognormalWithOffsetDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/MultinomialDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/MultinomialDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/MultivariateNormalDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/MultivariateNormalDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/NegativeBinomialDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/NegativeBinomialDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/NormalDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/NormalDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/OrnsteinUhlenbeckProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/OrnsteinUhlenbeckProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/PointMassDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/PointMassDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/PoissonDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/PoissonDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/ScaledDirichletDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/ScaledDirichletDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/SoftBoundUniformNormalDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/SoftBoundUniformNormalDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/StudentTDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/StudentTDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/UniformDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/UniformDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/UniformIntegerDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/UniformIntegerDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/VarianceGammaDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/VarianceGammaDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/WhiteNoiseDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/WhiteNoiseDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/WishartDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/math/WishartDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/MPEST.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/MPEST.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/AbstractPhyloBrownianProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/AbstractPhyloBrownianProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/AbstractPhyloContinuousCharacterHistoryProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/AbstractPhyloContinuousCharacterHistoryProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/AbstractPhyloContinuousCharacterProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/AbstractPhyloContinuousCharacterProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianCharacterHistoryProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianCharacterHistoryProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianProcessMVN.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianProcessMVN.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianProcessMultiSampleREML.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianProcessMultiSampleREML.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianProcessREML.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloBrownianProcessREML.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultiSampleOrnsteinUhlenbeckProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultiSampleOrnsteinUhlenbeckProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultiSampleOrnsteinUhlenbeckProcessREML.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultiSampleOrnsteinUhlenbeckProcessREML.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultivariateBrownianProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultivariateBrownianProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultivariateBrownianProcessMultiSampleREML.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultivariateBrownianProcessMultiSampleREML.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultivariateBrownianProcessREML.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloMultivariateBrownianProcessREML.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckProcessEVE.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckProcessEVE.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckProcessMVN.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckProcessMVN.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckREML.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckREML.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckThreePoint.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloOrnsteinUhlenbeckThreePoint.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloWhiteNoiseProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/continuousCharacter/PhyloWhiteNoiseProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCCompressedAlignment.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCCompressedAlignment.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCKernels.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCKernels.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCSiteHomogeneousBinary.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCSiteHomogeneousBinary.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCSiteHomogeneousDollo.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCSiteHomogeneousDollo.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCSiteHomogeneousDolloBinary.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/substitution/PhyloCTMCSiteHomogeneousDolloBinary.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/substitution/PhyloDistanceGamma.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/substitution/PhyloDistanceGamma.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/AbstractMultispeciesCoalescent.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/AbstractMultispeciesCoalescent.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/AbstractRootedTreeDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/AbstractRootedTreeDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/DuplicationLossProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/DuplicationLossProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescent.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescent.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescentInverseGammaPrior.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescentInverseGammaPrior.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescentMigration.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescentMigration.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescentMigrationODE.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescentMigrationODE.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescentUniformPrior.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/MultispeciesCoalescentUniformPrior.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/NodeAgeConstrainedTreeDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/NodeAgeConstrainedTreeDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/NodeOrderConstrainedTreeDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/NodeOrderConstrainedTreeDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/NodeOrderWeightedConstrainedTreeDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/NodeOrderWeightedConstrainedTreeDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/TopologyConstrainedTreeDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/TopologyConstrainedTreeDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/UltrametricTreeDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/UltrametricTreeDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/UniformTimeTreeDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/UniformTimeTreeDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/UniformTopologyBranchLengthDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/UniformTopologyBranchLengthDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/UniformTopologyDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/UniformTopologyDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/AbstractBirthDeathProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/AbstractBirthDeathProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/AbstractCharacterHistoryBirthDeathProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/AbstractCharacterHistoryBirthDeathProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/AbstractPiecewiseConstantFossilizedRangeProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/AbstractPiecewiseConstantFossilizedRangeProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/BirthDeathBurstProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/BirthDeathBurstProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/BirthDeathProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/BirthDeathProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/CDCladoSE.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/CDCladoSE.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/CDCladoSEExtinction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/CDCladoSEExtinction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/CDCladoSEObserved.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/CDCladoSEObserved.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConditionedBirthDeathShiftProcessContinuous.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConditionedBirthDeathShiftProcessContinuous.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConstantRateBirthDeathProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConstantRateBirthDeathProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConstantRateCompleteBirthDeathProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConstantRateCompleteBirthDeathProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConstantRateOutgroupBirthDeathProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConstantRateOutgroupBirthDeathProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConstantRateSerialSampledBirthDeathProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/ConstantRateSerialSampledBirthDeathProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/DivergenceTimeCDF.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/DivergenceTimeCDF.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/DiversityDependentPureBirthProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/DiversityDependentPureBirthProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/EpisodicBirthDeathProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/EpisodicBirthDeathProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/EpisodicBirthDeathSamplingTreatmentProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/EpisodicBirthDeathSamplingTreatmentProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/HeterogeneousRateBirthDeath.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/HeterogeneousRateBirthDeath.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/MixedSamplingBirthDeathProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/MixedSamplingBirthDeathProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/OdeHeterogeneousRateBirthDeath.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/OdeHeterogeneousRateBirthDeath.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/PiecewiseConstantFossilizedBirthDeathProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/PiecewiseConstantFossilizedBirthDeathProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/PiecewiseConstantFossilizedBirthDeathRangeProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/PiecewiseConstantFossilizedBirthDeathRangeProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/PiecewiseConstantSerialSampledBirthDeathProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/PiecewiseConstantSerialSampledBirthDeathProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/SSE_ODE.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/SSE_ODE.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/SampledSpeciationBirthDeathProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/SampledSpeciationBirthDeathProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/StateDependentSpeciationExtinctionProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/StateDependentSpeciationExtinctionProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/TimeVaryingStateDependentSpeciationExtinctionProcess.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/birthdeath/TimeVaryingStateDependentSpeciationExtinctionProcess.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/AbstractCoalescent.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/AbstractCoalescent.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/ConstantPopulationCoalescent.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/ConstantPopulationCoalescent.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/ConstantPopulationHeterochronousCoalescent.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/ConstantPopulationHeterochronousCoalescent.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/HeterochronousCoalescent.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/HeterochronousCoalescent.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/PiecewiseConstantCoalescent.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/PiecewiseConstantCoalescent.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/PiecewiseConstantHeterochronousCoalescent.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/PiecewiseConstantHeterochronousCoalescent.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/demography/ConstantDemographicFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/demography/ConstantDemographicFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/demography/DemographicFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/demography/DemographicFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/demography/ExponentialDemographicFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/demography/ExponentialDemographicFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/demography/LinearDemographicFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/distributions/phylogenetics/tree/coalescent/demography/LinearDemographicFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/Function.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/Function.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/LogicalAndFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/LogicalAndFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/LogicalOrFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/LogicalOrFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/LogicalUnotFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/LogicalUnotFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/MaxFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/MaxFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/MeanFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/MeanFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/MedianFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/MedianFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/MinFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/MinFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/ModuloFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/ModuloFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/NormalizeVectorFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/NormalizeVectorFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/StandardDeviationFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/StandardDeviationFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/SumFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/SumFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/SumIntegerFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/SumIntegerFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/VarianceFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/builtin/VarianceFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/CummulativeDistributionFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/CummulativeDistributionFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DecomposedVarianceCovarianceFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DecomposedVarianceCovarianceFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DiscretizeBetaFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DiscretizeBetaFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DiscretizeBetaQuadratureFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DiscretizeBetaQuadratureFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DiscretizeDistributionFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DiscretizeDistributionFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DiscretizeGammaFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DiscretizeGammaFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DiscretizeGammaQuadratureFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DiscretizeGammaQuadratureFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DiscretizeLognormalQuadratureFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/DiscretizeLognormalQuadratureFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/PartialToCorrelationFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/PartialToCorrelationFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/QuantileFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/QuantileFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/VarianceCovarianceFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/distribution/VarianceCovarianceFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/AbsoluteValueFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/AbsoluteValueFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/AbsoluteValueVectorFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/AbsoluteValueVectorFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/AssembleOrder1ContinuousMRFFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/AssembleOrder1ContinuousMRFFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/AssembleOrder2ContinuousMRFFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/AssembleOrder2ContinuousMRFFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/CeilFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/CeilFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/ChooseFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/ChooseFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/ContinuousFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/ContinuousFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/EmpiricalQuantileFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/EmpiricalQuantileFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/ExponentialFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/ExponentialFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/FloorFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/FloorFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/GammaFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/GammaFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/GeographicalDistanceFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/GeographicalDistanceFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/HyperbolicSineFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/HyperbolicSineFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/HyperbolicTangentFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/HyperbolicTangentFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/LnFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/LnFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/LnProbabilityFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/LnProbabilityFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/LogFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/LogFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/LogisticFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/LogisticFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/MatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/MatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/PosteriorPredictiveProbabilityFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/PosteriorPredictiveProbabilityFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/PowerFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/PowerFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/PowerVectorFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/PowerVectorFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/RoundFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/RoundFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/ShortestDistanceFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/ShortestDistanceFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/SqrtFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/SqrtFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/TruncateFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/TruncateFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/UpperTriangle.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/math/UpperTriangle.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/CheckNodeOrderConstraintsFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/CheckNodeOrderConstraintsFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/CladeSpecificHierarchicalBranchRateFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/CladeSpecificHierarchicalBranchRateFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/CladogeneticSpeciationRateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/CladogeneticSpeciationRateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/CoalaFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/CoalaFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ComputeWeightedNodeOrderConstraintsScoreFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ComputeWeightedNodeOrderConstraintsScoreFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/DispersalExtinctionRateStructureFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/DispersalExtinctionRateStructureFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/DispersalExtinctionRootStructureFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/DispersalExtinctionRootStructureFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/MaximumTreeFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/MaximumTreeFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/PhyloDiversityFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/PhyloDiversityFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/PhylogeneticIndependentContrastsFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/PhylogeneticIndependentContrastsFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/PhylogeneticIndependentContrastsMultiSampleFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/PhylogeneticIndependentContrastsMultiSampleFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/PruneTreeFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/PruneTreeFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/RootedTripletDistributionFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/RootedTripletDistributionFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/StitchTreeFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/StitchTreeFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/TreeAssemblyFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/TreeAssemblyFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/TreeScaleFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/TreeScaleFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/BiogeographyCladogeneticBirthDeathFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/BiogeographyCladogeneticBirthDeathFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/ChromosomesCladogenicBirthDeathFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/ChromosomesCladogenicBirthDeathFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/ChromosomesCladogenicStateFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/ChromosomesCladogenicStateFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/ChromosomesPloidyCladogenicBirthDeathFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/ChromosomesPloidyCladogenicBirthDeathFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/DECCladogeneticStateFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/DECCladogeneticStateFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/EpochCladogeneticStateFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/EpochCladogeneticStateFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/MixtureCladogeneticStateFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/cladogenetic/MixtureCladogeneticStateFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/AdjacentRateModifierFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/AdjacentRateModifierFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/BiogeographyRateGeneratorSequenceFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/BiogeographyRateGeneratorSequenceFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/DistanceRateModifierFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/DistanceRateModifierFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/GeneralRateGeneratorSequenceFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/GeneralRateGeneratorSequenceFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/HostSwitchRateModifierFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/HostSwitchRateModifierFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/RangeEvolutionRateModifierFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/RangeEvolutionRateModifierFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/SiteRateModifierFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/SiteRateModifierFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/StateCountRateModifierFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratemap/StateCountRateModifierFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/ChromosomesPloidyRateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/ChromosomesPloidyRateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/ChromosomesRateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/ChromosomesRateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/CodonSynonymousNonsynonymousHKYRateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/CodonSynonymousNonsynonymousHKYRateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/CodonSynonymousNonsynonymousRateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/CodonSynonymousNonsynonymousRateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/CovarionFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/CovarionFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/CovarionRateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/CovarionRateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/DECRateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/DECRateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/DECStationaryFrequenciesFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/DECStationaryFrequenciesFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/EpochRateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/EpochRateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/F81RateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/F81RateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/FreeBinaryRateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/FreeBinaryRateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/FreeKRateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/FreeKRateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/FreeSymmetricRateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/FreeSymmetricRateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/GtrRateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/GtrRateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/HiddenStateRateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/HiddenStateRateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/HkyRateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/HkyRateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/InfiniteSitesRateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/InfiniteSitesRateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/JcRateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/JcRateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/K80RateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/K80RateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/Kimura81RateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/Kimura81RateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/OrderedRateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/OrderedRateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/PoMoRateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/PoMoRateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/PoMoRootFrequenciesFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/PoMoRootFrequenciesFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/ReversiblePoMoRateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/ReversiblePoMoRateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/SampledCladogenesisRootFrequenciesFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/SampledCladogenesisRootFrequenciesFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/T92RateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/T92RateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/TamuraNeiRateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/TamuraNeiRateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/TimRateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/TimRateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/TvmRateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/TvmRateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/WagRateMatrixFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/ratematrix/WagRateMatrixFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/tree/ChronoToPhyloFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/tree/ChronoToPhyloFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/tree/EarlyBurstRatesFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/tree/EarlyBurstRatesFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/tree/ExtantTreeFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/phylogenetics/tree/ExtantTreeFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/popgen/PattersonsDFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/popgen/PattersonsDFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/popgen/SegregatingSitesFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/popgen/SegregatingSitesFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/popgen/TajimasDFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/popgen/TajimasDFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/popgen/TajimasPiFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/popgen/TajimasPiFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/popgen/WattersonThetaFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/popgen/WattersonThetaFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/vector/SimplexFromVectorFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/vector/SimplexFromVectorFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/vector/SimplexFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/vector/SimplexFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/vector/SimplexScaleFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/vector/SimplexScaleFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/vector/SortVectorFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/vector/SortVectorFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/vector/VectorFlattenFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/functions/vector/VectorFlattenFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpArgument.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpArgument.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpDistribution.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpDistribution.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpEntry.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpEntry.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpFunction.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpFunction.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpMonitor.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpMonitor.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpMove.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpMove.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpReference.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpReference.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpRenderer.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpRenderer.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpSystem.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpSystem.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpType.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/help/RbHelpType.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/BitsetCharacterDataConverter.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/BitsetCharacterDataConverter.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/BranchLengthDistributionReader.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/BranchLengthDistributionReader.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/DelimitedCharacterDataReader.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/DelimitedCharacterDataReader.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/DelimitedCharacterDataWriter.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/DelimitedCharacterDataWriter.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/DelimitedDataReader.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/DelimitedDataReader.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/DistanceMatrixReader.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/DistanceMatrixReader.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/FastaWriter.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/FastaWriter.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/MatrixReader.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/MatrixReader.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/NclReader.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/NclReader.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/NewickConverter.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/NewickConverter.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/NewickTreeReader.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/NewickTreeReader.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/NexusWriter.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/NexusWriter.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/PhylowoodConverter.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/PhylowoodConverter.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/PoMoCountFileReader.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/PoMoCountFileReader.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/PoMoState4Converter.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/PoMoState4Converter.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/ProgressBar.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/ProgressBar.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/RelativeNodeAgeConstraintsReader.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/RelativeNodeAgeConstraintsReader.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/RelativeNodeAgeWeightedConstraintsReader.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/RelativeNodeAgeWeightedConstraintsReader.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/TaxonReader.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/TaxonReader.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/TimeAtlasDataReader.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/TimeAtlasDataReader.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/TraceContinuousReader.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/TraceContinuousReader.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/TraceReader.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/io/TraceReader.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/CholeskyDecomposition.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/CholeskyDecomposition.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/EigenSystem.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/EigenSystem.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/RandomNumberFactory.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/RandomNumberFactory.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/RandomNumberGenerator.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/RandomNumberGenerator.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathCombinatorialFunctions.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathCombinatorialFunctions.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathFunctions.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathFunctions.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathGaussianElimination.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathGaussianElimination.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathHelper.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathHelper.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathLogic.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathLogic.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathMatrix.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathMatrix.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathVector.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/RbMathVector.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/RbStatisticsHelper.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/RbStatisticsHelper.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionBeta.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionBeta.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionBinomial.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionBinomial.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionBivariatePoisson.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionBivariatePoisson.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionCauchy.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionCauchy.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionChisq.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionChisq.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionCompoundPoissonNormal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionCompoundPoissonNormal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionDecomposedInverseWishart.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionDecomposedInverseWishart.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionDirichlet.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionDirichlet.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionExponential.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionExponential.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionF.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionF.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionGamma.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionGamma.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionGeometric.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionGeometric.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionGilbertGraph.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionGilbertGraph.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionHalfCauchy.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionHalfCauchy.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionInverseGamma.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionInverseGamma.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionInverseWishart.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionInverseWishart.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionLKJ.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionLKJ.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionLaplace.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionLaplace.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionLogistic.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionLogistic.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionLognormal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionLognormal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionMultinomial.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionMultinomial.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionMultivariateNormal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionMultivariateNormal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionNegativeBinomial.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionNegativeBinomial.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionNormal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionNormal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionPoisson.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionPoisson.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionScaledDirichlet.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionScaledDirichlet.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionStudentT.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionStudentT.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionUniform.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionUniform.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionVarianceGamma.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionVarianceGamma.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionWishart.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/math/distributions/DistributionWishart.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/AbstractFileMonitor.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/AbstractFileMonitor.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/ExtendedNewickTreeMonitor.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/ExtendedNewickTreeMonitor.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/ModelMonitor.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/ModelMonitor.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/Monitor.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/Monitor.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/NexusMonitor.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/NexusMonitor.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/ProbabilityMonitor.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/ProbabilityMonitor.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/ScreenMonitor.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/ScreenMonitor.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/StochasticBranchRateMonitor.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/StochasticBranchRateMonitor.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/StochasticBranchStateTimesMonitor.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/StochasticBranchStateTimesMonitor.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/StochasticVariableMonitor.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/StochasticVariableMonitor.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/VariableMonitor.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/VariableMonitor.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/characterhistory/CharacterHistoryNodeMonitor.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/characterhistory/CharacterHistoryNodeMonitor.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/characterhistory/CharacterHistoryPosteriorPredictiveMonitor.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/characterhistory/CharacterHistoryPosteriorPredictiveMonitor.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/characterhistory/PhylowoodNhxMonitor.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/monitors/characterhistory/PhylowoodNhxMonitor.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/AbstractGibbsMove.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/AbstractGibbsMove.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/AbstractMove.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/AbstractMove.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/EllipticalSliceSamplingLognormalIIDMove.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/EllipticalSliceSamplingLognormalIIDMove.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/EllipticalSliceSamplingSimpleMove.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/EllipticalSliceSamplingSimpleMove.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/MetropolisHastingsMove.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/MetropolisHastingsMove.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/Move.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/Move.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/MoveSchedule.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/MoveSchedule.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/PseudoGibbsMetaMove.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/PseudoGibbsMetaMove.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/RandomMoveSchedule.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/RandomMoveSchedule.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/SequentialMoveSchedule.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/SequentialMoveSchedule.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/SingleRandomMoveSchedule.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/SingleRandomMoveSchedule.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/SliceSamplingMove.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/SliceSamplingMove.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/ContinuousEventBirthDeathProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/ContinuousEventBirthDeathProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/ContinuousEventScaleProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/ContinuousEventScaleProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/DiscreteEventBirthDeathProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/DiscreteEventBirthDeathProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/DiscreteEventCategoryRandomWalkProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/DiscreteEventCategoryRandomWalkProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/EventBirthDeathFromAgeProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/EventBirthDeathFromAgeProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/EventBirthDeathProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/EventBirthDeathProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/EventBranchTimeBetaProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/EventBranchTimeBetaProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/EventTimeSlideProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/EventTimeSlideProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/GibbsDrawCharacterHistoryProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/characterhistory/GibbsDrawCharacterHistoryProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/compound/ConjugateInverseWishartMove.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/compound/ConjugateInverseWishartMove.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/compound/CorrelationMatrixReparameterizationMove.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/compound/CorrelationMatrixReparameterizationMove.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/compound/RateAgeBetaShift.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/compound/RateAgeBetaShift.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/mixture/DPPGibbsConcentrationMove.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/mixture/DPPGibbsConcentrationMove.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/mixture/MultiValueEventBirthDeathProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/mixture/MultiValueEventBirthDeathProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/mixture/MultiValueEventScaleProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/mixture/MultiValueEventScaleProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/mixture/MultiValueEventSlideProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/mixture/MultiValueEventSlideProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/AVMVNProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/AVMVNProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/ContinuousCharacterDataScaleProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/ContinuousCharacterDataScaleProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/ContinuousCharacterDataSlideProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/ContinuousCharacterDataSlideProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/Proposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/Proposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/UpDownScaleProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/UpDownScaleProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/UpDownSlideBactrianProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/UpDownSlideBactrianProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/UpDownSlideProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/UpDownSlideProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixElementBetaProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixElementBetaProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixElementSwapProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixElementSwapProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixExpansionProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixExpansionProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixPartialElementBetaProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixPartialElementBetaProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixRandomWalkProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixRandomWalkProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixSpecificElementBetaProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/CorrelationMatrixSpecificElementBetaProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/GraphFlipCliqueProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/GraphFlipCliqueProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/GraphFlipEdgeProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/GraphFlipEdgeProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/GraphShiftEdgeProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/GraphShiftEdgeProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/MatrixRealSingleElementScaleProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/MatrixRealSingleElementScaleProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/MatrixRealSingleElementSlideProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/MatrixRealSingleElementSlideProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/MatrixRealSymmetricSingleElementSlidingProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/matrix/MatrixRealSymmetricSingleElementSlidingProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/BetaProbabilityProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/BetaProbabilityProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/BinarySwitchProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/BinarySwitchProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/GMRFHyperpriorGibbsMove.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/GMRFHyperpriorGibbsMove.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/GMRFOrder2HyperpriorGibbsMove.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/GMRFOrder2HyperpriorGibbsMove.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/GMRFUnevenGridHyperpriorGibbsMove.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/GMRFUnevenGridHyperpriorGibbsMove.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/GammaScaleProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/GammaScaleProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/HalfRandomDiveProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/HalfRandomDiveProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/LevyJumpProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/LevyJumpProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/LevyJumpSumProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/LevyJumpSumProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/MirrorMultiplierProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/MirrorMultiplierProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/MirrorProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/MirrorProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/RandomDiveProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/RandomDiveProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/RandomGeometricWalkProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/RandomGeometricWalkProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/RandomIntegerWalkProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/RandomIntegerWalkProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/ScaleBactrianCauchyProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/ScaleBactrianCauchyProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/ScaleBactrianProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/ScaleBactrianProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/ScaleProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/ScaleProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/ScaleProposalContinuous.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/ScaleProposalContinuous.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/ScaleUpDownProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/ScaleUpDownProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/SlideBactrianProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/SlideBactrianProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/SlideBactrianProposalContinuous.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/SlideBactrianProposalContinuous.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/SlideProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/SlideProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/SlideProposalContinuous.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/SlideProposalContinuous.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/SlideUpDownProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/scalar/SlideUpDownProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/simplex/BetaSimplexProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/simplex/BetaSimplexProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/simplex/DirichletSimplexProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/simplex/DirichletSimplexProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/simplex/ElementSwapSimplexProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/simplex/ElementSwapSimplexProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/AddRemoveTipProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/AddRemoveTipProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/BranchLengthScaleProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/BranchLengthScaleProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/BurstEventProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/BurstEventProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/CollapseExpandFossilBranchProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/CollapseExpandFossilBranchProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/EmpiricalTreeTopologyProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/EmpiricalTreeTopologyProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/FixedNodeheightPruneAndRegraftProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/FixedNodeheightPruneAndRegraftProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/GibbsPruneAndRegraftProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/GibbsPruneAndRegraftProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/IndependentTopologyProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/IndependentTopologyProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/LayeredScaleProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/LayeredScaleProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NarrowExchangeProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NarrowExchangeProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NarrowExchangeRateMatrixProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NarrowExchangeRateMatrixProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NearestNeighborInterchangeProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NearestNeighborInterchangeProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NearestNeighborInterchange_nonClockProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NearestNeighborInterchange_nonClockProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeRateTimeSlideUniformProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeRateTimeSlideUniformProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeScaleProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeScaleProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeSlideBetaProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeSlideBetaProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeSlidePathTruncatedNormalProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeSlidePathTruncatedNormalProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeSlideUniformAgeConstrainedProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeSlideUniformAgeConstrainedProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeSlideUniformCharacterHistoryProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeSlideUniformCharacterHistoryProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeSlideUniformProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeSlideUniformProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeSlideWeightedProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/NodeTimeSlideWeightedProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/RootTimeScaleBactrianProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/RootTimeScaleBactrianProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/RootTimeSlideUniformProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/RootTimeSlideUniformProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SpeciesNarrowExchangeProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SpeciesNarrowExchangeProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SpeciesSubtreeScaleBetaProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SpeciesSubtreeScaleBetaProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SpeciesSubtreeScaleProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SpeciesSubtreeScaleProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SpeciesTreeNodeSlideProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SpeciesTreeNodeSlideProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SpeciesTreeScaleProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SpeciesTreeScaleProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SubtreePruneRegraftProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SubtreePruneRegraftProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SubtreeScaleProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/SubtreeScaleProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/TipTimeSlideUniformProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/TipTimeSlideUniformProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/TreeNodeAgeUpdateProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/TreeNodeAgeUpdateProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/TreeScaleProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/tree/TreeScaleProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/ElementScaleProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/ElementScaleProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/ElementSlideProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/ElementSlideProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/HSRFHyperpriorsGibbsMove.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/HSRFHyperpriorsGibbsMove.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/HSRFOrder2HyperpriorsGibbsMove.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/HSRFOrder2HyperpriorsGibbsMove.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/HSRFUnevenGridHyperpriorsGibbsMove.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/HSRFUnevenGridHyperpriorsGibbsMove.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/MultipleElementScaleProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/MultipleElementScaleProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/ShrinkExpandProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/ShrinkExpandProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/ShrinkExpandScaleProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/ShrinkExpandScaleProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/SingleElementScaleProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/SingleElementScaleProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/SingleElementSlideProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/SingleElementSlideProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/SynchronizedVectorFixedSingleElementSlideProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/SynchronizedVectorFixedSingleElementSlideProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorBinarySwitchProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorBinarySwitchProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorFixedSingleElementSlideProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorFixedSingleElementSlideProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorScaleProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorScaleProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorSingleElementScaleProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorSingleElementScaleProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorSingleElementSlideProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorSingleElementSlideProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorSlideProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorSlideProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorSlideRecenterProposal.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/moves/proposal/vector/VectorSlideRecenterProposal.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/statistics/mixture/MeanVecContinuousValStatistic.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/statistics/mixture/MeanVecContinuousValStatistic.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/statistics/mixture/VectorDoubleProductStatistic.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/statistics/mixture/VectorDoubleProductStatistic.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/BranchScoreDistanceStatistic.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/BranchScoreDistanceStatistic.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/MrcaIndexStatistic.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/MrcaIndexStatistic.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/NodeAgeByID.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/NodeAgeByID.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/SymmetricDifferenceStatistic.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/SymmetricDifferenceStatistic.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/TmrcaStatistic.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/TmrcaStatistic.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/TreeBipartitions.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/TreeBipartitions.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/TreeLengthStatistic.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/TreeLengthStatistic.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/TreePairwiseDistances.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/TreePairwiseDistances.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/TreePairwiseNodalDistances.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/statistics/tree/TreePairwiseNodalDistances.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/utils/AlignedArena.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/utils/AlignedArena.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/utils/BirthDeathForwardSimulator.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/utils/BirthDeathForwardSimulator.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/utils/MpiUtilities.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/utils/MpiUtilities.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/utils/RbException.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/utils/RbException.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/utils/RbFileManager.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/utils/RbFileManager.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/utils/RbSettings.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/utils/RbSettings.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/utils/RbUtil.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/utils/RbUtil.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/utils/StartingTreeSimulator.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/utils/StartingTreeSimulator.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/utils/StringUtilities.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/utils/StringUtilities.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/utils/ThreadPool.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/utils/ThreadPool.cpp.o.d"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/utils/TreeUtilities.cpp.o"
+  "CMakeFiles/rb-core.dir/root/repo/src/core/utils/TreeUtilities.cpp.o.d"
+  "librb-core.a"
+  "librb-core.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rb-core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()